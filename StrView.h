@@ -136,388 +136,8479 @@ STR_VIEW_LINK    Ssize StrView_find_last_of(StrView s, StrView accept);
 STR_VIEW_LINK    Ssize StrView_find_last_not_of(StrView s, StrView reject);
 
 
+//----------------------------------------------------------------------------
+// glob
+//----------------------------------------------------------------------------
+
+/// @brief one '*' free piece of a compiled glob, matching a fixed number of bytes.
+/// a literal segment has no '?' nor "[...]" and only hold its bytes, a
+/// horspool skip table when it is searched, other ones hold a 256 bit set
+/// per byte and a shift-and table.
+struct StrGlobSegment {
+  Ssize size;
+  const uint8_t *literal;
+  const uint8_t *skip;
+  const uint8_t (*classes)[32];
+  const uint64_t *masks;
+};
+
+/// @brief glob pattern compiled for matching without backtracking.
+/// @see StrGlob_compile, StrGlob_match
+typedef struct {
+  Ssize min_size;
+  Ssize segment_count;
+  struct StrGlobSegment *segments;
+  uint8_t required[32];
+} StrGlob;
+
+/// @brief a set of compiled globs matched together.
+///
+/// each glob is indexed by one literal key, hashed in slots. globs of a slot
+/// and globs without key are linked by next in index order.
+/// @see StrGlobSet_compile, StrGlobSet_match
+typedef struct {
+  Ssize count;
+  StrGlob *globs;
+  Ssize slot_mask;
+  Ssize *slots;
+  Ssize *next;
+  Ssize unkeyed;
+  uint32_t key_sizes[3];
+} StrGlobSet;
+
+
+/// @brief compile a glob pattern.
+///
+/// '*' matches any byte sequence, '?' any single byte, "[...]" a byte of the
+/// set with ranges "a-z" and negation by a leading '!' or '^'. A '\\' makes
+/// the next byte literal, an unclosed '[' is a literal '['.
+/// @param glob receive the compiled pattern, release it with StrGlob_free.
+/// it is left empty on failure and may still be passed to StrGlob_free.
+/// @param pattern glob pattern, it is not referenced after compilation.
+/// @return false on allocation failure.
+STR_VIEW_LINK bool StrGlob_compile(StrGlob *glob, StrView pattern);
+
+
+/// @brief release memory own by a compiled glob.
+STR_VIEW_LINK void StrGlob_free(StrGlob *glob);
+
+
+/// @brief match a whole string view against a compiled glob.
+///
+/// segments between '*' are searched leftmost once, no backtracking and
+/// no allocation. literal segments are searched with horspool skips, other
+/// ones with shift-and.
+/// @param glob compiled glob
+/// @param s string view to test
+/// @return true if all of s is matched by the glob.
+STR_VIEW_LINK bool StrGlob_match(const StrGlob *glob, StrView s);
+
+
+/// @brief compile many glob patterns at once.
+/// @param set receive the compiled globs, release it with StrGlobSet_free.
+/// @param patterns array of glob patterns
+/// @param count number of patterns
+/// @return false on allocation failure.
+STR_VIEW_LINK bool StrGlobSet_compile(StrGlobSet *set, const StrView *patterns, Ssize count);
+
+
+/// @brief release memory own by a set of compiled globs.
+STR_VIEW_LINK void StrGlobSet_free(StrGlobSet *set);
+
+
+/// @brief match a string view against all globs of the set.
+///
+/// each glob is keyed by its fixed leading bytes, its fixed trailing bytes
+/// or up to 4 fixed bytes of a middle segment, whichever is longest. s is
+/// scanned once for the keys of all globs, only globs whose key is found
+/// and globs without any fixed byte are then matched with StrGlob_match.
+/// @param set compiled globs
+/// @param s string view to test
+/// @param matches bitmap of (count + 63) / 64 words, bit i is set when glob i match.
+/// may be NULL to only count.
+/// @return number of matching globs.
+STR_VIEW_LINK Ssize StrGlobSet_match(const StrGlobSet *set, StrView s, uint64_t *matches);
+
+
+/// @brief find the first glob of the set matching a string view.
+///
+/// globs are handled by blocks of 4096 without allocation, s is scanned once
+/// per block until one has a matching glob.
+/// @return index of the matching glob or -1.
+STR_VIEW_LINK Ssize StrGlobSet_find(const StrGlobSet *set, StrView s);
+
+
+//----------------------------------------------------------------------------
+// prefix set
+//----------------------------------------------------------------------------
+
+/// @brief immutable set of prefixes stored as a compressed trie in one
+/// position independent block of bytes.
+///
+/// the block can be written to a file as is and later used in place from a
+/// mmap'd region with StrPrefixSet_from_bytes.
+/// @see StrPrefixSet_build, StrPrefixSet_longest, StrPrefixSet_all
+typedef struct {
+  StrView bytes;
+  Ssize count;
+  void *memory;
+} StrPrefixSet;
+
+
+/// @brief build a prefix set from an array of keys.
+/// @param set receive the prefix set, release it with StrPrefixSet_free.
+/// @param keys array of keys, they are copied in the set. on duplicates the
+/// lowest index is kept.
+/// @param count number of keys
+/// @return false on allocation failure or if the set exceeds 4GiB.
+STR_VIEW_LINK bool StrPrefixSet_build(StrPrefixSet *set, const StrView *keys, Ssize count);
+
+
+/// @brief use serialized bytes of a prefix set in place, nothing is copied.
+/// @pre bytes come from StrPrefixSet_bytes, possibly of another process
+/// with the same byte order.
+/// @param set receive the prefix set.
+/// @param bytes serialized set, must outlive the set.
+/// @return false if bytes do not hold a prefix set.
+STR_VIEW_LINK bool StrPrefixSet_from_bytes(StrPrefixSet *set, StrView bytes);
+
+
+/// @brief serialized form of a prefix set.
+/// @return view over the set bytes, suitable to be written to a file.
+STR_VIEW_LINK StrView StrPrefixSet_bytes(const StrPrefixSet *set);
+
+
+/// @brief release memory own by a prefix set.
+STR_VIEW_LINK void StrPrefixSet_free(StrPrefixSet *set);
+
+
+/// @brief find the longest key that is a prefix of s.
+/// @param set prefix set
+/// @param s string view to test
+/// @param size receive the size of the matching key, may be NULL.
+/// @return index of the key in the build array or -1 if none match.
+STR_VIEW_LINK Ssize StrPrefixSet_longest(const StrPrefixSet *set, StrView s, Ssize *size);
+
+
+/// @brief find all keys that are a prefix of s, shortest first.
+/// @param set prefix set
+/// @param s string view to test
+/// @param indexes receive indexes of the keys in the build array.
+/// @param capacity max number of indexes to write.
+/// @return number of matching keys, may be more than capacity.
+STR_VIEW_LINK Ssize StrPrefixSet_all(const StrPrefixSet *set, StrView s, Ssize *indexes, Ssize capacity);
+
+
+//----------------------------------------------------------------------------
+// csv
+//----------------------------------------------------------------------------
+
+/// @brief streaming RFC 4180 parser over chunks of bytes.
+///
+/// records are found 64 bytes at a time, fields are views into the chunk.
+/// quote parity is tracked per block, so a quote inside an unquoted field
+/// is not supported.
+/// @see StrCsv_init, StrCsv_feed, StrCsv_next, StrCsv_rest
+typedef struct {
+  StrView input;
+  Bool last;
+  uint8_t delimiter;
+  uint8_t quote;
+  Ssize pos;
+  Ssize block;
+  uint64_t bits;
+  uint64_t inside;
+  Ssize scanned;
+  uint64_t scanned_inside;
+} StrCsv;
+
+
+/// @brief init a parser.
+/// @param csv parser to init
+/// @param delimiter field separator like ',' or '\\t'
+/// @param quote quote byte, usually '"'
+STR_VIEW_LINK void StrCsv_init(StrCsv *csv, uint8_t delimiter, uint8_t quote);
+
+
+/// @brief give the next chunk to parse.
+///
+/// the chunk must start with the bytes of StrCsv_rest of the previous one.
+/// they are not scanned again: the quote state at their end is kept and
+/// only the new bytes are searched for the end of the record, its fields
+/// are then split in one pass. a record spread over many chunks is so
+/// scanned twice at most, not once per chunk.
+/// @param csv parser
+/// @param chunk bytes to parse, must outlive the fields of its records.
+/// @param last true if the chunk ends the input, the final record may then
+/// have no trailing newline.
+STR_VIEW_LINK void StrCsv_feed(StrCsv *csv, StrView chunk, Bool last);
+
+
+/// @brief parse next record of the current chunk.
+///
+/// fields point into the chunk, quoted fields without doubled quotes are
+/// seen without their quotes. only fields with doubled quotes are unescaped
+/// into scratch, a scratch as big as the chunk is always enough.
+/// a trailing '\\r' of a record is ignored.
+/// @param csv parser
+/// @param fields receive the fields of the record
+/// @param capacity max number of fields to write
+/// @param scratch buffer for unescaped fields, reused by each call
+/// @param scratch_size size in byte of scratch
+/// @return number of fields of the record, may be more than capacity.
+/// 0 when no complete record is left in the chunk,
+/// -1 when scratch is too small, the record is then not consumed.
+STR_VIEW_LINK Ssize StrCsv_next(StrCsv *csv, StrView *fields, Ssize capacity,
+                                uint8_t *scratch, Ssize scratch_size);
+
+
+/// @brief bytes of the current chunk not consumed as records.
+/// @return an incomplete record to put in front of the next chunk.
+STR_VIEW_LINK StrView StrCsv_rest(const StrCsv *csv);
+
+
+//----------------------------------------------------------------------------
+// escape
+//----------------------------------------------------------------------------
+
+/// @brief string literal syntax for escape and unescape.
+enum StrEscape {
+  STR_ESCAPE_JSON, ///< '\\uXXXX' escapes, invalid utf8 become U+FFFD
+  STR_ESCAPE_C     ///< '\\ooo' escapes, invalid utf8 bytes are kept as octal
+};
+
+
+/// @brief exact size of an escaped string view.
+/// @param s string view to escape
+/// @param kind literal syntax
+/// @return size in byte of the escaped content.
+/// @see StrView_escape
+STR_VIEW_LINK Ssize StrView_escape_size(StrView s, enum StrEscape kind);
+
+
+/// @brief escape a string view to be put between double quotes.
+///
+/// '"', '\\', control bytes and invalid utf8 are escaped, valid utf8 is
+/// copied as is. clean runs are found 32 bytes at a time.
+/// @param s string view to escape
+/// @param kind literal syntax
+/// @param out buffer to receive escaped bytes
+/// @param capacity size in byte of out
+/// @return s itself when nothing need to be escaped, else a view over out.
+/// if out is too small, data is NULL and size is minus the needed size.
+/// @see StrView_escape_size, StrView_unescape
+STR_VIEW_LINK StrView StrView_escape(StrView s, enum StrEscape kind, uint8_t *out, Ssize capacity);
+
+
+/// @brief unescape the content of a string literal.
+///
+/// \\uXXXX surrogate pairs are decoded to utf8, other bytes must be valid
+/// utf8 and for json not control bytes.
+/// unescaping never grow the size, a capacity of s.size is always enough.
+/// @param s string view to unescape, without surrounding quotes
+/// @param kind literal syntax
+/// @param out buffer to receive unescaped bytes
+/// @param capacity size in byte of out
+/// @return s itself when there is nothing to unescape, else a view over out.
+/// on invalid input, data is NULL and size is -1 minus the offset of the
+/// invalid byte or escape. if out is too small, data is NULL and size is
+/// -1 - s.size, as for an error just past the end of s.
+/// @see StrView_escape
+STR_VIEW_LINK StrView StrView_unescape(StrView s, enum StrEscape kind, uint8_t *out, Ssize capacity);
+
+
+//----------------------------------------------------------------------------
+// hex and base64
+//----------------------------------------------------------------------------
+
+/// @brief base64 options, can be or'ed.
+enum StrBase64 {
+  STR_BASE64_STD   = 0, ///< "+/" alphabet with '=' padding
+  STR_BASE64_URL   = 1, ///< "-_" alphabet
+  STR_BASE64_NOPAD = 2  ///< no '=' padding, decode then reject '='
+};
+
+
+/// @brief size of hex encoding.
+STR_VIEW_LINK Ssize StrView_hex_encode_size(StrView s);
+
+
+/// @brief encode bytes to lowercase hex.
+/// @pre capacity >= StrView_hex_encode_size(s)
+/// @param s bytes to encode, e.g. from StrView_from_raw
+/// @param out buffer to receive hex digits
+/// @param capacity size in byte of out
+/// @return view over the hex digits in out.
+STR_VIEW_LINK StrView StrView_hex_encode(StrView s, uint8_t *out, Ssize capacity);
+
+
+/// @brief size of decoded hex.
+STR_VIEW_LINK Ssize StrView_hex_decode_size(StrView s);
+
+
+/// @brief decode hex digits of any case to bytes.
+/// @pre capacity >= StrView_hex_decode_size(s)
+/// @param s hex digits
+/// @param out buffer to receive bytes
+/// @param capacity size in byte of out
+/// @return view over the bytes in out. on invalid input, data is NULL and
+/// size is -1 minus the offset of the invalid digit.
+STR_VIEW_LINK StrView StrView_hex_decode(StrView s, uint8_t *out, Ssize capacity);
+
+
+/// @brief exact size of base64 encoding.
+/// @param s bytes to encode
+/// @param flags or'ed StrBase64 values
+STR_VIEW_LINK Ssize StrView_base64_encode_size(StrView s, int flags);
+
+
+/// @brief encode bytes to base64.
+/// @pre capacity >= StrView_base64_encode_size(s, flags)
+/// @param s bytes to encode, e.g. from StrView_from_raw
+/// @param flags or'ed StrBase64 values
+/// @param out buffer to receive base64 text
+/// @param capacity size in byte of out
+/// @return view over the base64 text in out.
+STR_VIEW_LINK StrView StrView_base64_encode(StrView s, int flags, uint8_t *out, Ssize capacity);
+
+
+/// @brief exact size of decoded base64, valid input is assumed.
+/// @param s base64 text
+/// @param flags or'ed StrBase64 values
+STR_VIEW_LINK Ssize StrView_base64_decode_size(StrView s, int flags);
+
+
+/// @brief decode base64 text to bytes.
+///
+/// input is strict: no white space, padding as requested by flags and
+/// unused bits of the last character must be zero.
+/// @pre capacity >= StrView_base64_decode_size(s, flags)
+/// @param s base64 text
+/// @param flags or'ed StrBase64 values
+/// @param out buffer to receive bytes
+/// @param capacity size in byte of out
+/// @return view over the bytes in out. on invalid input, data is NULL and
+/// size is -1 minus the offset of the invalid character.
+STR_VIEW_LINK StrView StrView_base64_decode(StrView s, int flags, uint8_t *out, Ssize capacity);
+
+
+//----------------------------------------------------------------------------
+// edit distance
+//----------------------------------------------------------------------------
+
+/// @brief levenshtein distance between bytes sequences.
+///
+/// bit parallel, O(n) for a shorter string up to 64 bytes, O(n * m / 64)
+/// otherwise.
+/// @param s1 first string view
+/// @param s2 second string view
+/// @return number of byte insertions, deletions and substitutions,
+/// -1 on allocation failure for a shorter string over 64 bytes.
+/// @see StrView_edit_distance_max, UTF8View_edit_distance
+STR_VIEW_LINK Ssize StrView_edit_distance(StrView s1, StrView s2);
+
+
+/// @brief bounded levenshtein distance between bytes sequences.
+///
+/// stop as soon as the distance is known to exceed max.
+/// @param s1 first string view
+/// @param s2 second string view
+/// @param max greatest distance of interest
+/// @return the distance if it is <= max, else -1.
+STR_VIEW_LINK Ssize StrView_edit_distance_max(StrView s1, StrView s2, Ssize max);
+
+
+/// @brief levenshtein distance between codepoints sequences.
+/// @see StrView_edit_distance
+STR_VIEW_LINK Ssize UTF8View_edit_distance(UTF8View s1, UTF8View s2);
+
+
+/// @brief bounded levenshtein distance between codepoints sequences.
+/// @see StrView_edit_distance_max
+STR_VIEW_LINK Ssize UTF8View_edit_distance_max(UTF8View s1, UTF8View s2, Ssize max);
+
+
+/// @brief find a substring within max_errors edits of a pattern.
+///
+/// the match ending first is found, then its shortest start.
+/// @param s string view to search
+/// @param match pattern
+/// @param max_errors max number of byte edits
+/// @param size receive the size of the matching substring, may be NULL.
+/// @return position of the matching substring or -1.
+/// @see StrView_find
+STR_VIEW_LINK Ssize StrView_find_approx(StrView s, StrView match, Ssize max_errors, Ssize *size);
+
+
+//----------------------------------------------------------------------------
+// normalization
+//----------------------------------------------------------------------------
+
+/// @brief unicode normalization forms.
+enum StrNormalForm {
+  STR_NFC,
+  STR_NFD
+};
+
+/// @brief result of a normalization quick check (UAX #15).
+enum StrQuickCheck {
+  STR_QC_YES,  ///< already normalized
+  STR_QC_NO,   ///< not normalized
+  STR_QC_MAYBE ///< only a full normalization can tell
+};
+
+
+/// @brief check if a utf8 view is normalized without normalizing it.
+///
+/// bytes of codepoints below U+0300 (NFC) or U+00C0 (NFD) are skipped 16
+/// or 32 at a time, other codepoints are checked with two level tables.
+/// @param s8 utf8 view
+/// @param form normalization form
+/// @param offset receive the offset of the first codepoint that is not
+/// STR_QC_YES, or s8.size. may be NULL.
+/// @return quick check result.
+/// @see UTF8View_normalize
+STR_VIEW_LINK enum StrQuickCheck UTF8View_quick_check(UTF8View s8, enum StrNormalForm form, Ssize *offset);
+
+
+/// @brief normalize a utf8 view.
+///
+/// bytes before the first offending codepoint found by quick check are
+/// copied, only the rest is normalized. the output is in stream safe format:
+/// a U+034F CGJ is inserted before a codepoint that would extend a run of
+/// non starters, counted in canonical decompositions, over 30.
+/// @param s8 utf8 view
+/// @param form normalization form
+/// @param out buffer to receive normalized bytes, 3 * s8.size is always
+/// enough.
+/// @param capacity size in byte of out
+/// @return s8 itself when it is already normalized and stream safe, even
+/// when quick check is only STR_QC_MAYBE, else a view over out.
+/// if out is too small, data is NULL and size is minus the needed size.
+/// @see UTF8View_quick_check
+STR_VIEW_LINK UTF8View UTF8View_normalize(UTF8View s8, enum StrNormalForm form, uint8_t *out, Ssize capacity);
+
+
+//----------------------------------------------------------------------------
+// builder
+//----------------------------------------------------------------------------
+
+/// @brief a piece of builder storage, bytes are never moved once written.
+struct StrBuilderChunk {
+  struct StrBuilderChunk *previous;
+  uint8_t *data;
+  Ssize size;
+  Ssize capacity;
+};
+
+/// @brief append only byte storage made of growing chunks.
+///
+/// appending never moves written bytes, a full chunk is kept and a twice
+/// bigger one is started. bytes are made contiguous once by StrBuilder_view.
+/// after an allocation failure all appends do nothing and return false.
+/// a builder points to itself and must not be copied once init.
+/// @see StrBuilder_init, StrBuilder_append, StrBuilder_view
+typedef struct {
+  struct StrBuilderChunk *last;
+  struct StrBuilderChunk first;
+  Ssize total;
+  Bool failed;
+} StrBuilder;
+
+
+/// @brief init a builder.
+/// @param b builder to init, release it with StrBuilder_free.
+/// @param buffer first chunk, like a stack array, may be NULL. it is not
+/// released by the builder.
+/// @param capacity size in byte of buffer
+STR_VIEW_LINK void StrBuilder_init(StrBuilder *b, uint8_t *buffer, Ssize capacity);
+
+
+/// @brief release memory own by a builder.
+STR_VIEW_LINK void StrBuilder_free(StrBuilder *b);
+
+
+/// @brief empty a builder, its largest chunk is kept for reuse.
+STR_VIEW_LINK void StrBuilder_clear(StrBuilder *b);
+
+
+/// @brief number of bytes appended.
+STR_VIEW_LINK Ssize StrBuilder_size(const StrBuilder *b);
+
+
+/// @brief make sure next size bytes are appended without allocation.
+/// @return false on allocation failure.
+STR_VIEW_LINK bool StrBuilder_reserve(StrBuilder *b, Ssize size);
+
+
+/// @brief append size bytes to be written by the caller.
+/// @pre size > 0
+/// @return pointer to the size contiguous bytes or NULL on allocation failure.
+STR_VIEW_LINK uint8_t *StrBuilder_extend(StrBuilder *b, Ssize size);
+
+
+/// @brief append bytes of a string view.
+/// @return false on allocation failure.
+STR_VIEW_LINK bool StrBuilder_append(StrBuilder *b, StrView s);
+
+
+/// @brief append a byte.
+/// @return false on allocation failure.
+STR_VIEW_LINK bool StrBuilder_append_byte(StrBuilder *b, uint8_t c);
+
+
+/// @brief append utf8 encoding of a codepoint.
+///
+/// invalid codepoints like surrogates are appended as REPLACEMENT_MARCK.
+/// @return false on allocation failure or invalid codepoint.
+STR_VIEW_LINK bool StrBuilder_append_codepoint(StrBuilder *b, int32_t codepoint);
+
+
+/// @brief append decimal digits of a signed integer.
+/// @return false on allocation failure.
+STR_VIEW_LINK bool StrBuilder_append_int(StrBuilder *b, int64_t value);
+
+
+/// @brief append decimal digits of an unsigned integer.
+/// @return false on allocation failure.
+STR_VIEW_LINK bool StrBuilder_append_uint(StrBuilder *b, uint64_t value);
+
+
+/// @brief append views with a separator between them.
+///
+/// the joined size is computed first, so at most one allocation is done.
+/// @param b builder
+/// @param views array of views
+/// @param count number of views
+/// @param separator view appended between two views
+/// @return false on allocation failure.
+STR_VIEW_LINK bool StrBuilder_join(StrBuilder *b, const StrView *views, Ssize count, StrView separator);
+
+
+/// @brief append s with all non overlapping occurences of match replaced.
+/// @param b builder
+/// @param s string view to copy
+/// @param match view to search with StrView_find, nothing is replaced if empty.
+/// @param replacement view appended instead of each match
+/// @return number of replacements or -1 on allocation failure.
+STR_VIEW_LINK Ssize StrBuilder_replace_all(StrBuilder *b, StrView s, StrView match, StrView replacement);
+
+
+/// @brief contiguous view over all appended bytes.
+///
+/// if bytes span many chunks, they are copied once in a single chunk.
+/// the view is valid until the next append, clear or free.
+/// @return view over the bytes. after an allocation failure, data is NULL
+/// and size is -1.
+STR_VIEW_LINK StrView StrBuilder_view(StrBuilder *b);
+
+
+//----------------------------------------------------------------------------
+// sorted dictionary
+//----------------------------------------------------------------------------
+
+/// @brief immutable sorted set of keys, front coded in blocks of 16 keys
+/// and stored in one position independent block of bytes.
+///
+/// a key only stores the suffix it does not share with the previous key of
+/// its block, the first key of each block is stored whole and indexed.
+/// like StrPrefixSet, the bytes can be written to a file and later used in
+/// place from a mmap'd region with StrDict_from_bytes.
+/// ids are ranks of keys in StrView_compare order.
+/// @see StrDict_build, StrDict_find, StrDict_get, StrDict_prefix_range
+typedef struct {
+  StrView bytes;
+  Ssize count;
+  Ssize max_key_size;
+  void *memory;
+} StrDict;
+
+
+/// @brief build a dictionary from an array of keys.
+/// @param dict receive the dictionary, release it with StrDict_free.
+/// @param keys array of keys in any order, they are copied in the
+/// dictionary. duplicates are stored once.
+/// @param count number of keys
+/// @return false on allocation failure.
+STR_VIEW_LINK bool StrDict_build(StrDict *dict, const StrView *keys, Ssize count);
+
+
+/// @brief use serialized bytes of a dictionary in place, nothing is copied
+/// nor scanned.
+/// @pre bytes come from StrDict_bytes, possibly of another process with the
+/// same byte order.
+/// @param dict receive the dictionary.
+/// @param bytes serialized dictionary, must outlive the dictionary.
+/// @return false if bytes do not hold a dictionary.
+STR_VIEW_LINK bool StrDict_from_bytes(StrDict *dict, StrView bytes);
+
+
+/// @brief serialized form of a dictionary.
+/// @return view over the dictionary bytes, suitable to be written to a file.
+STR_VIEW_LINK StrView StrDict_bytes(const StrDict *dict);
+
+
+/// @brief release memory own by a dictionary.
+STR_VIEW_LINK void StrDict_free(StrDict *dict);
+
+
+/// @brief decode the key of an id.
+/// @pre 0 <= id < dict->count
+/// @param dict dictionary
+/// @param id key id
+/// @param out buffer to receive the key, dict->max_key_size is always enough.
+/// @param capacity size in byte of out
+/// @return view over the key in out. if out is too small, data is NULL and
+/// size is minus the key size.
+STR_VIEW_LINK StrView StrDict_get(const StrDict *dict, Ssize id, uint8_t *out, Ssize capacity);
+
+
+/// @brief find the id of a key.
+/// @return id of the key or -1 if it is not in the dictionary.
+STR_VIEW_LINK Ssize StrDict_find(const StrDict *dict, StrView key);
+
+
+/// @brief find the first key not before a key.
+/// @return id of the first key >= key, dict->count if none.
+STR_VIEW_LINK Ssize StrDict_lower_bound(const StrDict *dict, StrView key);
+
+
+/// @brief find all keys starting with a prefix, they have consecutive ids.
+/// @param dict dictionary
+/// @param prefix prefix of the keys
+/// @param first receive the id of the first key with the prefix.
+/// @return number of keys with the prefix.
+STR_VIEW_LINK Ssize StrDict_prefix_range(const StrDict *dict, StrView prefix, Ssize *first);
+
+
+//----------------------------------------------------------------------------
+// line reader
+//----------------------------------------------------------------------------
+
+#if defined(__unix__) || defined(__APPLE__)
+
+/// @brief line reader options.
+enum StrLineFlags {
+  STR_LINE_CRLF = 1, ///< drop the '\\r' of "\\r\\n" line endings
+  STR_LINE_UTF8 = 2  ///< flag lines that are not valid utf8 with EILSEQ
+};
+
+/// @brief buffered reader of lines from a file descriptor.
+///
+/// lines are views into the buffer, newlines are found 64 bytes at a time.
+/// before each read the unfinished line is moved to the start of the
+/// buffer, the buffer doubles when a line does not fit.
+/// @see StrLineReader_init, StrLineReader_next
+typedef struct {
+  int fd;
+  int flags;
+  int error;
+  Bool eof;
+  uint8_t *buffer;
+  Ssize capacity;
+  Ssize pos;
+  Ssize end;
+  Ssize next;
+  uint64_t mask;
+} StrLineReader;
+
+
+/// @brief init a line reader.
+/// @param reader reader to init, release it with StrLineReader_free.
+/// @param fd file descriptor to read, it is not closed by the reader.
+/// @param capacity initial buffer size, 0 for a default of 64KiB.
+/// @param flags StrLineFlags combination
+/// @return false on allocation failure.
+STR_VIEW_LINK bool StrLineReader_init(StrLineReader *reader, int fd, Ssize capacity, int flags);
+
+
+/// @brief release memory own by a line reader.
+STR_VIEW_LINK void StrLineReader_free(StrLineReader *reader);
+
+
+/// @brief read next line.
+///
+/// a last line without newline is still a line.
+/// @param reader line reader
+/// @param line receive the line without its newline, valid until the next
+/// call.
+/// @return false at end of input or on a read error, reader->error is then
+/// 0 at end of input or an errno value. with STR_LINE_UTF8, an invalid line
+/// is still given and true returned, with reader->error set to EILSEQ until
+/// the next call.
+STR_VIEW_LINK bool StrLineReader_next(StrLineReader *reader, StrView *line);
+
+#endif
+
+
+//----------------------------------------------------------------------------
+// trigram index
+//----------------------------------------------------------------------------
+
+/// @brief immutable index of the trigrams of a collection of documents,
+/// used to prefilter substring searches.
+///
+/// each distinct 3 byte sequence maps to the sorted ids of the documents
+/// containing it, stored as delta varints. like StrPrefixSet, the index is
+/// one position independent block of bytes that can be written to a file
+/// and later used in place with StrTrigramIndex_from_bytes.
+/// builds share no state, so slices of a collection can be indexed by
+/// separate threads and searched one after the other.
+/// @see StrTrigramIndex_build, StrTrigramIndex_search
+typedef struct {
+  StrView bytes;
+  Ssize doc_count;
+  Ssize trigram_count;
+  void *memory;
+} StrTrigramIndex;
+
+
+/// @brief build the trigram index of documents.
+/// @param index receive the index, release it with StrTrigramIndex_free.
+/// @param docs array of documents, the id of a document is its index.
+/// they are not referenced by the index.
+/// @param count number of documents, at most UINT32_MAX.
+/// @return false on allocation failure or too many documents.
+STR_VIEW_LINK bool StrTrigramIndex_build(StrTrigramIndex *index, const StrView *docs, Ssize count);
+
+
+/// @brief use serialized bytes of an index in place, nothing is copied.
+/// @pre bytes come from StrTrigramIndex_bytes, possibly of another process
+/// with the same byte order.
+/// @param index receive the index.
+/// @param bytes serialized index, must outlive the index.
+/// @return false if bytes do not hold a trigram index.
+STR_VIEW_LINK bool StrTrigramIndex_from_bytes(StrTrigramIndex *index, StrView bytes);
+
+
+/// @brief serialized form of a trigram index.
+/// @return view over the index bytes, suitable to be written to a file.
+STR_VIEW_LINK StrView StrTrigramIndex_bytes(const StrTrigramIndex *index);
+
+
+/// @brief release memory own by a trigram index.
+STR_VIEW_LINK void StrTrigramIndex_free(StrTrigramIndex *index);
+
+
+/// @brief find documents that may contain a needle.
+///
+/// posting lists of the 8 rarest trigrams of the needle are intersected,
+/// needles under 3 bytes match all documents.
+/// @param index trigram index
+/// @param needle searched bytes
+/// @param ids receive ids of candidate documents in increasing order.
+/// @param capacity max number of ids to write.
+/// @return number of candidates, may be more than capacity.
+/// @see StrTrigramIndex_search
+STR_VIEW_LINK Ssize StrTrigramIndex_candidates(const StrTrigramIndex *index, StrView needle, Ssize *ids, Ssize capacity);
+
+
+/// @brief find documents containing a needle.
+///
+/// candidates are checked with StrView_contains.
+/// @param index trigram index
+/// @param docs documents given to StrTrigramIndex_build
+/// @param needle searched bytes
+/// @param ids receive ids of matching documents in increasing order.
+/// @param capacity max number of ids to write.
+/// @return number of matching documents, may be more than capacity.
+STR_VIEW_LINK Ssize StrTrigramIndex_search(const StrTrigramIndex *index, const StrView *docs, StrView needle,
+                                           Ssize *ids, Ssize capacity);
+
+
+//----------------------------------------------------------------------------
+// case mapping
+//----------------------------------------------------------------------------
+
+/// @brief case mappings.
+enum StrCase {
+  STR_CASE_LOWER,
+  STR_CASE_UPPER
+};
+
+
+/// @brief size of a utf8 view after case mapping.
+///
+/// mappings are the full ones of unicode without context, so "\\u00DF" is
+/// upper cased to "SS" and a final sigma is not special.
+/// @param s8 utf8 view
+/// @param kind case mapping
+/// @return size in byte of the mapped view.
+/// @see UTF8View_to_case
+STR_VIEW_LINK Ssize UTF8View_case_size(UTF8View s8, enum StrCase kind);
+
+
+/// @brief map the case of a utf8 view.
+///
+/// ascii bytes are mapped 16 or 32 at a time, only other codepoints are
+/// decoded and looked up in two level tables.
+/// @param s8 utf8 view
+/// @param kind case mapping
+/// @param out buffer to receive mapped bytes, 3 * s8.size is always enough.
+/// @param capacity size in byte of out
+/// @return s8 itself when no codepoint changes, else a view over out.
+/// if out is too small, data is NULL and size is minus the needed size.
+/// @see UTF8View_case_size, UTF8View_to_case_inplace
+STR_VIEW_LINK UTF8View UTF8View_to_case(UTF8View s8, enum StrCase kind, uint8_t *out, Ssize capacity);
+
+
+/// @brief map the case of utf8 bytes in place.
+///
+/// it stops before the first codepoint whose mapping has another size,
+/// which never happens for ascii.
+/// @pre data holds a valid utf8 sequence.
+/// @param data bytes to map
+/// @param size size in byte of data
+/// @param kind case mapping
+/// @return number of bytes mapped, size when all of data is mapped.
+/// @see UTF8View_to_case
+STR_VIEW_LINK Ssize UTF8View_to_case_inplace(uint8_t *data, Ssize size, enum StrCase kind);
+
+
+//----------------------------------------------------------------------------
+// batch
+//----------------------------------------------------------------------------
+
+/// @brief column of strings in the Arrow layout: string i is the bytes
+/// [offsets[i], offsets[i + 1]) of bytes.
+/// @see StrColumn_get
+typedef struct {
+  const uint8_t *bytes;
+  const int32_t *offsets;
+  Ssize count;
+} StrColumn;
+
+
+/// @brief hash a string view, not cryptographic.
+/// @param s string view
+/// @param seed any value, equal seeds give equal hashes for equal views on
+/// the same byte order.
+/// @return 64 bit hash
+STR_VIEW_LINK uint64_t StrView_hash(StrView s, uint64_t seed);
+
+
+/// @brief string view of the i-th string of a column.
+/// @pre 0 <= i < column.count
+STR_VIEW_LINK StrView StrColumn_get(StrColumn column, Ssize i);
+
+
+/// @brief check utf8 validity of many views.
+///
+/// ascii views are accepted 16 or 32 bytes at a time.
+/// @param views array of views
+/// @param count number of views
+/// @param valid bitmap of (count + 63) / 64 words, bit i is set when view i
+/// is valid utf8.
+/// @return number of valid views.
+STR_VIEW_LINK Ssize StrView_batch_is_valid_utf8(const StrView *views, Ssize count, uint64_t *valid);
+
+
+/// @brief count codepoints of many valid utf8 views.
+/// @param views array of views
+/// @param count number of views
+/// @param counts receive count numbers of codepoint.
+STR_VIEW_LINK void StrView_batch_count_codepoint(const StrView *views, Ssize count, Ssize *counts);
+
+
+/// @brief hash many views with StrView_hash.
+STR_VIEW_LINK void StrView_batch_hash(const StrView *views, Ssize count, uint64_t seed, uint64_t *hashes);
+
+
+/// @brief compare many views to the same value for equality.
+/// @param views array of views
+/// @param count number of views
+/// @param value view to compare with
+/// @param equal bitmap of (count + 63) / 64 words, bit i is set when view i
+/// is equal to value.
+/// @return number of equal views.
+STR_VIEW_LINK Ssize StrView_batch_is_equal(const StrView *views, Ssize count, StrView value, uint64_t *equal);
+
+
+/// @brief compare many views to the same value.
+/// @param views array of views
+/// @param count number of views
+/// @param value view to compare with
+/// @param orders receive -1, 0 or 1 as the sign of StrView_compare for
+/// each view.
+STR_VIEW_LINK void StrView_batch_compare(const StrView *views, Ssize count, StrView value, int8_t *orders);
+
+
+/// @brief check utf8 validity of all strings of a column.
+///
+/// the bytes of the column are scanned once 64 at a time, across string
+/// boundaries. only strings with non ascii bytes are decoded.
+/// @see StrView_batch_is_valid_utf8
+STR_VIEW_LINK Ssize StrColumn_is_valid_utf8(StrColumn column, uint64_t *valid);
+
+
+/// @brief count codepoints of all valid utf8 strings of a column.
+///
+/// continuation bytes of the column are counted 64 at a time, across
+/// string boundaries.
+/// @see StrView_batch_count_codepoint
+STR_VIEW_LINK void StrColumn_count_codepoint(StrColumn column, Ssize *counts);
+
+
+/// @see StrView_batch_hash
+STR_VIEW_LINK void StrColumn_hash(StrColumn column, uint64_t seed, uint64_t *hashes);
+
+
+/// @brief compare all strings of a column to the same value for equality.
+///
+/// only strings of the value size are compared.
+/// @see StrView_batch_is_equal
+STR_VIEW_LINK Ssize StrColumn_is_equal(StrColumn column, StrView value, uint64_t *equal);
+
+
+/// @see StrView_batch_compare
+STR_VIEW_LINK void StrColumn_compare(StrColumn column, StrView value, int8_t *orders);
+
+
+//----------------------------------------------------------------------------
+// grapheme clusters and width
+//----------------------------------------------------------------------------
+
+/// @brief get first extended grapheme cluster (UAX #29) of a utf8 view.
+///
+/// a printable ascii byte followed by an ascii byte is a cluster alone,
+/// other codepoints are looked up in two level tables.
+/// @param s8 a valid utf8 view
+/// @return view over the first cluster, empty if s8 is.
+/// @see UTF8View_count_grapheme
+STR_VIEW_LINK UTF8View UTF8View_get_grapheme(UTF8View s8);
+
+
+/// @brief count extended grapheme clusters.
+///
+/// runs of printable ascii are counted 16 or 32 bytes at a time.
+/// @param s8 a valid utf8 view
+/// @return number of grapheme clusters.
+STR_VIEW_LINK Ssize UTF8View_count_grapheme(UTF8View s8);
+
+
+/// @brief display width in terminal columns.
+///
+/// a grapheme cluster is 2 columns wide if one of its codepoints has a wide
+/// or fullwidth east asian width, an emoji presentation, or is a
+/// pictographic codepoint followed by U+FE0F. it is 0 wide if all its
+/// codepoints are controls, marks, format characters or hangul medial and
+/// final jamos, else 1 wide.
+/// runs of printable ascii are measured 16 or 32 bytes at a time.
+/// @param s8 a valid utf8 view
+/// @return number of columns.
+STR_VIEW_LINK Ssize UTF8View_width(UTF8View s8);
+
+
+/// @brief longest prefix of whole grapheme clusters fitting a display width.
+/// @param s8 a valid utf8 view
+/// @param width max number of columns
+/// @return prefix of s8 at most width columns wide.
+/// @see UTF8View_width
+STR_VIEW_LINK UTF8View UTF8View_truncate_width(UTF8View s8, Ssize width);
+
+
 #endif // INCLUDE_STR_VIEW_H
 
-//
-//
-//
-//
-//****************************
-#ifdef STR_VIEW_IMPLEMENTATION
-//****************************
+//
+//
+//
+//
+//****************************
+#ifdef STR_VIEW_IMPLEMENTATION
+//****************************
+
+#include <assert.h>
+#include <string.h>
+#include <ctype.h>
+
+// usage as compiler flag
+//  -DSTR_VIEW_MALLOC=my_malloc -DSTR_VIEW_FREE=my_free
+// only needed by compiled objects (glob, ...), views never allocate.
+#ifndef STR_VIEW_MALLOC
+#include <stdlib.h>
+#define STR_VIEW_MALLOC malloc
+#define STR_VIEW_FREE   free
+#endif
+
+// vector paths are picked at compile time, e.g. -mavx2, with a scalar
+// fallback for other targets.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// bit i is set when p[i] == c, for the 64 bytes at p.
+static uint64_t eq_mask64_(const uint8_t *p, uint8_t c) {
+#if defined(__AVX2__)
+  const __m256i v = _mm256_set1_epi8((char)c);
+  const __m256i lo = _mm256_loadu_si256((const __m256i*)p);
+  const __m256i hi = _mm256_loadu_si256((const __m256i*)(p + 32));
+  const uint32_t m_lo = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, v));
+  const uint32_t m_hi = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, v));
+  return m_lo | ((uint64_t)m_hi << 32);
+#elif defined(__SSE2__)
+  const __m128i v = _mm_set1_epi8((char)c);
+  uint64_t mask = 0;
+  for (int i = 0; i < 4; ++i) {
+    const __m128i x = _mm_loadu_si128((const __m128i*)(p + 16 * i));
+    mask |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(x, v)) << (16 * i);
+  }
+  return mask;
+#else
+  uint64_t mask = 0;
+  for (int i = 0; i < 64; ++i) {
+    mask |= (uint64_t)(p[i] == c) << i;
+  }
+  return mask;
+#endif
+}
+
+// bit i is the xor of bits [0, i] of x.
+static uint64_t prefix_xor_(uint64_t x) {
+  x ^= x << 1;
+  x ^= x << 2;
+  x ^= x << 4;
+  x ^= x << 8;
+  x ^= x << 16;
+  x ^= x << 32;
+  return x;
+}
+
+// index of lowest set bit.
+// @pre x != 0
+static int ctz64_(uint64_t x) {
+#if defined(__GNUC__)
+  return __builtin_ctzll(x);
+#else
+  int n = 0;
+  while (!(x & 1)) {
+    x >>= 1;
+    ++n;
+  }
+  return n;
+#endif
+}
+
+// size of the leading run of bytes below limit, 0x80 for an ascii run.
+static Ssize ascii_run_(const uint8_t *p, Ssize size, uint8_t limit) {
+  Ssize i = 0;
+
+#if defined(__AVX2__)
+  const __m256i below = _mm256_set1_epi8((char)(limit - 1));
+  for (; i + 32 <= size; i += 32) {
+    const __m256i x = _mm256_loadu_si256((const __m256i*)(p + i));
+    const uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(x, below), below));
+    if (mask != 0) return i + ctz64_(mask);
+  }
+#elif defined(__SSE2__)
+  const __m128i below = _mm_set1_epi8((char)(limit - 1));
+  for (; i + 16 <= size; i += 16) {
+    const __m128i x = _mm_loadu_si128((const __m128i*)(p + i));
+    const uint32_t mask = 0xFFFF ^ (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(x, below), below));
+    if (mask != 0) return i + ctz64_(mask);
+  }
+#endif
+
+  for (; i < size; ++i) {
+    if (p[i] >= limit) break;
+  }
+
+  return i;
+}
+
+static struct CodeResult decode_lead_(uint8_t lead) {
+  struct CodeResult cr;
+
+  if (lead <= 0x7F) {
+    cr.codepoint = lead;
+    cr.size = 1;
+  } else if ((lead & 0xE0) == 0xC0) {
+    cr.codepoint = (lead & 0x1F);
+    cr.size = 2;
+  } else if ((lead & 0xF0) == 0xE0) {
+    cr.codepoint = (lead & 0x0F);
+    cr.size = 3;
+  } else if ((lead & 0xF8) == 0xF0) {
+    cr.codepoint = (lead & 0x07);
+    cr.size = 4;
+  } else if ((lead & 0xFC) == 0xF8) {
+    cr.codepoint = (lead & 0x03);
+    cr.size = 5;
+  } else if ((lead & 0xFE) == 0xFC) {
+    cr.codepoint = (lead & 0x01);
+    cr.size = 6;
+  } else {
+    cr.codepoint = lead; 
+    cr.size = 1;
+  }
+
+  return cr;
+}
+
+static struct CodeResult decode_tail_(CodeResult cr, StrView s) {
+  static const struct {
+    int size;
+    struct {
+      int32_t min, max;
+    } codepoint_ranges;
+    struct {
+      uint8_t min, max;
+    } bytes_ranges[4];
+  } tbl[] = {
+      {1, {0x000000, 0x00007F}, {{0x00, 0x7F}}},
+      {2, {0x000080, 0x0007FF}, {{0xC2, 0xDF}, {0x80, 0xBF}}},
+      {3, {0x000800, 0x000FFF}, {{0xE0, 0xE0}, {0xA0, 0xBF}, {0x80, 0xBF}}},
+      {3, {0x001000, 0x00FFFF}, {{0xE1, 0xEF}, {0x80, 0xBF}, {0x80, 0xBF}}},
+      {4, {0x010000, 0x03FFFF}, {{0xF0, 0xF0}, {0x90, 0xBF}, {0x80, 0xBF}, {0x80, 0xBF}}},
+      {4, {0x040000, 0x0FFFFF}, {{0xF1, 0xF3}, {0x80, 0xBF}, {0x80, 0xBF}, {0x80, 0xBF}}},
+      {4, {0x100000, 0x10FFFF}, {{0xF4, 0xF4}, {0x80, 0x8F}, {0x80, 0xBF}, {0x80, 0xBF}}}
+    };
+
+  if (cr.size > s.size) {
+    cr.codepoint = CODEPOINT_INVALID;
+    cr.size = s.size;
+
+    return cr;
+  }
+
+  // make sure tail has all continuation bytes.
+  for (int i = 1; i < cr.size; ++i) {
+    if ((s.data[i] & 0xC0) != 0x80) {
+      cr.codepoint = CODEPOINT_INVALID;
+      cr.size = i;
+
+      return cr;
+    }
+  }
+
+  // updating codepoint value
+  for (int i = 1; i < cr.size; ++i) {
+    cr.codepoint = (cr.codepoint << 6) | (s.data[i] & 0x3F);
+  }
+  
+  // check ranges
+  bool is_valid = false;
+  for (int i = 0; i != (sizeof(tbl) / sizeof(tbl[0])); ++i) {
+    if (cr.size == tbl[i].size) {
+      const int32_t c_min = tbl[i].codepoint_ranges.min;
+      const int32_t c_max = tbl[i].codepoint_ranges.max;
+      if (cr.codepoint >= c_min && cr.codepoint <= c_max) {
+        is_valid = true;
+        for (int b = 0; b < tbl[i].size; ++b) {
+          const uint8_t b_min = tbl[i].bytes_ranges[b].min;
+          const uint8_t b_max = tbl[i].bytes_ranges[b].max;
+          const uint8_t value = s.data[b];
+          is_valid = is_valid && value >= b_min && value <= b_max;
+        }
+        break;
+      }
+    }
+  }
+  if (!is_valid) {
+    cr.codepoint = CODEPOINT_INVALID;
+  }
+
+  return cr;
+}
+
+StrView StrView_cast(UTF8View s8) {
+  StrView s = {s8.data, s8.size};
+  return s;
+}
+
+StrView StrView_from_raw(const void *ptr, Ssize size) {
+  StrView s = {(const uint8_t*)ptr, size};
+  return s;
+}
+
+StrView StrView_from_cstr(const char *s) {
+  StrView cstr = {(const uint8_t*)s, (Ssize)strlen(s)};
+  return cstr;
+}
+
+UTF8View UTF8View_from_strview(StrView s) {
+  UTF8View s8 = {s.data, 0};
+  
+  struct CodeResult cr;
+  while (cr = StrView_try_decode(s), cr.codepoint != CODEPOINT_INVALID) {
+    s8.size += cr.size;
+    s.data  += cr.size;
+    s.size  -= cr.size;
+  }
+
+  // set size <= 0 for uncomplete decoding
+  if (s.size != 0) {
+    s8.size = - s8.size;
+  }
+
+  return s8;
+}
+
+struct CodeResult UTF8View_get_codepoint(UTF8View s8) {
+  struct CodeResult cr = {CODEPOINT_INVALID, 0};
+
+  assert(s8.size > 0);
+  if (s8.size > 0) {
+    cr = decode_lead_(s8.data[0]);
+    assert(cr.size <= s8.size);
+
+    for (int i = 1; i < cr.size; ++i) {
+      cr.codepoint = (cr.codepoint << 6) | (s8.data[i] & 0x3F);
+    }
+ }
+
+  return cr;
+}
+
+struct CodeResult StrView_try_decode(StrView s) {
+  struct CodeResult cr = {CODEPOINT_INVALID, 0};
+  
+  if (s.size > 0) {
+    cr = decode_lead_(s.data[0]);
+    cr = decode_tail_(cr, s);
+  }
+  
+  return cr;
+}
+
+Ssize UTF8View_count_codepoint(UTF8View s8) {
+  Ssize count = 0;
+  
+  while (s8.size > 0) {
+    struct CodeResult cr = UTF8View_get_codepoint(s8);
+    s8.data += cr.size;
+    s8.size -= cr.size;
+    count++;
+  }
+  
+  return count;
+}
+
+Ssize StrView_count_codepoint(StrView s) {
+  Ssize count = 0;
+  
+  while (s.size > 0) {
+    struct CodeResult cr = StrView_try_decode(s);
+    Ssize size = (cr.codepoint != CODEPOINT_INVALID) ? cr.size : 1;
+
+    s.data += size;
+    s.size -= size;
+    count += size;
+  }
+  
+  return count;
+}
+
+bool StrView_is_empty(StrView s) {
+  return s.size == 0;
+}
+
+bool StrView_is_valid_utf8(StrView s) {
+  UTF8View s8 = UTF8View_from_strview(s);
+  
+  return s8.size == s.size;
+}
+
+int StrView_compare(StrView s1, StrView s2) {
+  const Ssize min_size = s1.size < s2.size ? s1.size : s2.size;
+  assert(min_size >= 0);// FIXME
+  
+  int result = memcmp(s1.data, s2.data, (Usize)min_size);
+  return (result != 0) ? result : s1.size - s2.size;
+}
+
+bool StrView_is_equal(StrView s1, StrView s2) {
+  assert(s1.size >= 0);
+
+  if (s1.size == s2.size) return !memcmp(s1.data, s2.data, (Usize)s1.size);
+
+  return false;
+}
+
+bool StrView_starts_with(StrView s, StrView prefix) {
+  assert(prefix.size >= 0);
+
+  if (s.size >= prefix.size)
+    return memcmp(s.data, prefix.data, (Usize)prefix.size) == 0;
+
+  return false;
+}
+
+bool StrView_ends_with(StrView s, StrView suffix) {
+  assert(suffix.size >= 0);
+
+  if (s.size >= suffix.size) {
+    const Ssize pos = s.size - suffix.size;
+    return memcmp(s.data + pos, suffix.data, (Usize)suffix.size) == 0;
+  }
+
+  return false;
+}
+
+bool StrView_contains(StrView s, StrView match) {
+  return StrView_find(s, match) >= 0;
+}
+
+StrView StrView_skip(StrView s, Ssize count) {
+  assert(count >= 0 && count <= s.size); // FIXME
+    
+  s.data += count;
+  s.size -= count;
+  
+  return s;
+}
+
+StrView StrView_skip_if(StrView s, Bool (*predicate)(int c)) {
+  Ssize i = 0;
+  while( i < s.size && predicate(s.data[i])) {
+    ++i;
+  }
+  s.data += i;
+  s.size -= i;
+  
+  return s;
+}
+
+StrView StrView_rskip_if(StrView s, Bool (*predicate)(int c)) {
+  Ssize i = 0;
+  while(i < s.size && predicate(s.data[s.size - 1 - i])) {
+    ++i;
+  }
+  s.size -= i;
+  
+  return s;
+}
+
+StrView StrView_trim(StrView s) {
+  return StrView_rskip_if(StrView_skip_if(s, isspace), isspace);
+}
+
+StrView StrView_substr(StrView s, Ssize pos, Ssize size) {
+  StrView sub = {NULL, 0};  
+
+  if (pos < 0) pos += s.size;
+  if (pos >= 0 && pos <= s.size) {
+    const Ssize max_size = s.size - pos;
+    sub.data = s.data + pos;
+    sub.size = ( size >= 0 && size <= max_size) ? size : max_size;
+  }
+
+  return sub;
+}
+
+Ssize StrView_find(StrView s, StrView match) {
+  assert(match.size >= 0);
+
+  Ssize pos = 0;
+  while (s.size - pos >= match.size) {
+    if (memcmp(s.data + pos, match.data, (Usize)match.size) == 0) return pos;
+    pos++;
+  }
+
+  return -1;
+}
+
+Ssize StrView_rfind(StrView s, StrView match) {
+  assert(match.size >= 0);
+
+  Ssize pos = s.size - match.size;
+  while (pos >= 0) {
+    if (memcmp(s.data + pos, match.data, (Usize)match.size) == 0) break;
+    pos--;
+  }
+
+  return pos;
+}
+
+Ssize StrView_index_of(StrView s, uint8_t c) {
+  for (Ssize i = 0; i < s.size; ++i) {
+    if (s.data[i] == c) return i;
+  }
+
+  return -1;
+}
+
+Ssize StrView_find_first_of(StrView s, StrView accept) {
+  uint8_t freq[256] = {0};
+
+  for (Ssize i = 0; i < accept.size; ++i) {
+    freq[accept.data[i]]++;
+  }
+  
+  for (Ssize pos = 0; pos < s.size; ++pos) {
+    if (freq[s.data[pos]] != 0) return pos;
+  }
+  
+  return -1;
+}
+
+Ssize StrView_find_first_not_of(StrView s, StrView reject) {
+  uint8_t freq[256] = {0};
+
+  for (Ssize i = 0; i < reject.size; ++i) {
+    freq[reject.data[i]]++;
+  }
+  
+  for (Ssize pos = 0; pos < s.size; ++pos) {
+    if (freq[s.data[pos]] == 0) return pos;
+  }
+  
+  return -1;
+}
+
+Ssize StrView_find_last_of(StrView s, StrView accept) {
+  uint8_t freq[256] = {0};
+
+  for (Ssize i = 0; i < accept.size; ++i) {
+    freq[accept.data[i]]++;
+  }
+  
+  Ssize pos = s.size;
+  while (--pos >= 0) {
+    if (freq[s.data[pos]] != 0) break;
+  }
+  
+  return pos;
+}
+
+Ssize StrView_find_last_not_of(StrView s, StrView reject) {
+  uint8_t freq[256] = {0};
+
+  for (Ssize i = 0; i < reject.size; ++i) {
+    freq[reject.data[i]]++;
+  }
+  
+  Ssize pos = s.size;
+  while (--pos >= 0) {
+    if (freq[s.data[pos]] == 0) break;
+  }
+
+  return pos;
+}
+
+//----------------------------------------------------------------------------
+// glob
+//----------------------------------------------------------------------------
+
+static void glob_set_add_(uint8_t set[32], uint8_t c) {
+  set[c >> 3] |= (uint8_t)(1u << (c & 7));
+}
+
+static bool glob_set_has_(const uint8_t set[32], uint8_t c) {
+  return (set[c >> 3] >> (c & 7)) & 1;
+}
+
+// parse one atom at p[i] into a byte set, literal receive the byte value
+// for a plain byte or -1 for '?' and '[...]'. return index after the atom.
+static Ssize glob_atom_(StrView p, Ssize i, uint8_t set[32], int *literal) {
+  uint8_t c = p.data[i];
+
+  memset(set, 0, 32);
+  if (c == '?') {
+    memset(set, 0xFF, 32);
+    *literal = -1;
+    return i + 1;
+  }
+
+  if (c == '[') {
+    Ssize j = i + 1;
+    bool negate = false;
+    if (j < p.size && (p.data[j] == '!' || p.data[j] == '^')) {
+      negate = true;
+      ++j;
+    }
+
+    // a ']' just after the opening is a member of the set
+    const Ssize first = j;
+    while (j < p.size && (p.data[j] != ']' || j == first)) {
+      uint8_t lo = p.data[j];
+      if (lo == '\\' && j + 1 < p.size) lo = p.data[++j];
+      uint8_t hi = lo;
+      if (j + 2 < p.size && p.data[j + 1] == '-' && p.data[j + 2] != ']') {
+        j += 2;
+        hi = p.data[j];
+        if (hi == '\\' && j + 1 < p.size) hi = p.data[++j];
+      }
+      for (int b = lo; b <= hi; ++b) {
+        glob_set_add_(set, (uint8_t)b);
+      }
+      ++j;
+    }
+
+    if (j < p.size) {
+      if (negate) {
+        for (int k = 0; k < 32; ++k) set[k] = (uint8_t)~set[k];
+      }
+      *literal = -1;
+      return j + 1;
+    }
+
+    // unclosed '[' is taken literally
+    memset(set, 0, 32);
+  } else if (c == '\\' && i + 1 < p.size) {
+    c = p.data[++i];
+  }
+
+  glob_set_add_(set, c);
+  *literal = c;
+
+  return i + 1;
+}
+
+// scan atoms up to next '*' or end of pattern.
+static Ssize glob_segment_(StrView p, Ssize i, Ssize *size, bool *is_literal) {
+  uint8_t set[32];
+  int literal;
+
+  *size = 0;
+  *is_literal = true;
+  while (i < p.size && p.data[i] != '*') {
+    i = glob_atom_(p, i, set, &literal);
+    *is_literal = *is_literal && literal >= 0;
+    ++*size;
+  }
+
+  return i;
+}
+
+static Ssize glob_skip_stars_(StrView p, Ssize i) {
+  while (i < p.size && p.data[i] == '*') {
+    ++i;
+  }
+
+  return i;
+}
+
+bool StrGlob_compile(StrGlob *glob, StrView pattern) {
+  Ssize segment_count = 0;
+  Ssize literal_bytes = 0;
+  Ssize class_count = 0;
+  Ssize mask_count = 0;
+  Ssize skip_count = 0;
+  bool last_skip = false;
+
+  memset(glob, 0, sizeof(*glob));
+
+  // first pass: measure storage, only middle literal segments are searched
+  for (Ssize i = 0;;) {
+    Ssize size;
+    bool is_literal;
+    i = glob_segment_(pattern, i, &size, &is_literal);
+    segment_count++;
+    if (is_literal) {
+      literal_bytes += size;
+    } else {
+      class_count += size;
+      mask_count++;
+    }
+    last_skip = is_literal && segment_count > 1 && size >= 2;
+    if (last_skip) skip_count++;
+    if (i == pattern.size) break;
+    i = glob_skip_stars_(pattern, i);
+  }
+  if (last_skip) skip_count--;
+
+  // one block: segments, masks, classes, skips then literal bytes
+  const Usize bytes = sizeof(struct StrGlobSegment) * (Usize)segment_count
+                    + sizeof(uint64_t) * 256 * (Usize)mask_count
+                    + 32 * (Usize)class_count
+                    + 256 * (Usize)skip_count
+                    + (Usize)literal_bytes;
+  uint8_t *memory = (uint8_t*)STR_VIEW_MALLOC(bytes);
+  if (memory == NULL) return false;
+
+  struct StrGlobSegment *segments = (struct StrGlobSegment*)memory;
+  uint64_t *masks = (uint64_t*)(segments + segment_count);
+  uint8_t (*classes)[32] = (uint8_t (*)[32])(masks + 256 * mask_count);
+  uint8_t *skips = (uint8_t*)(classes + class_count);
+  uint8_t *literals = skips + 256 * skip_count;
+
+  memset(masks, 0, sizeof(uint64_t) * 256 * (Usize)mask_count);
+  memset(glob->required, 0, sizeof(glob->required));
+  glob->min_size = 0;
+  glob->segment_count = segment_count;
+  glob->segments = segments;
+
+  // second pass: fill segments
+  Ssize i = 0;
+  for (Ssize n = 0; n < segment_count; ++n) {
+    struct StrGlobSegment *seg = &segments[n];
+    bool is_literal;
+    glob_segment_(pattern, i, &seg->size, &is_literal);
+
+    seg->literal = NULL;
+    seg->skip = NULL;
+    seg->classes = NULL;
+    seg->masks = NULL;
+    if (is_literal) {
+      seg->literal = literals;
+    } else {
+      seg->classes = classes;
+      seg->masks = masks;
+    }
+
+    for (Ssize k = 0; k < seg->size; ++k) {
+      uint8_t set[32];
+      int literal;
+      i = glob_atom_(pattern, i, set, &literal);
+      if (literal >= 0) glob_set_add_(glob->required, (uint8_t)literal);
+
+      if (is_literal) {
+        literals[k] = (uint8_t)literal;
+      } else {
+        memcpy(classes[k], set, 32);
+        if (k < 64) {
+          for (int c = 0; c < 256; ++c) {
+            if (glob_set_has_(set, (uint8_t)c)) masks[c] |= (uint64_t)1 << k;
+          }
+        }
+      }
+    }
+
+    if (is_literal && n > 0 && n < segment_count - 1 && seg->size >= 2) {
+      // horspool shifts, capped to 255 which never skips a match
+      const Ssize m = seg->size;
+      memset(skips, m < 255 ? (int)m : 255, 256);
+      for (Ssize k = 0; k < m - 1; ++k) {
+        const Ssize shift = m - 1 - k;
+        skips[literals[k]] = (uint8_t)(shift < 255 ? shift : 255);
+      }
+      seg->skip = skips;
+      skips += 256;
+    }
+
+    if (is_literal) {
+      literals += seg->size;
+    } else {
+      classes += seg->size;
+      masks += 256;
+    }
+    glob->min_size += seg->size;
+    i = glob_skip_stars_(pattern, i);
+  }
+
+  return true;
+}
+
+void StrGlob_free(StrGlob *glob) {
+  STR_VIEW_FREE(glob->segments);
+  glob->segments = NULL;
+  glob->segment_count = 0;
+}
+
+static bool glob_segment_at_(const struct StrGlobSegment *seg, const uint8_t *data, Ssize from) {
+  if (seg->literal != NULL) {
+    return seg->size == 0 || memcmp(data, seg->literal, (Usize)seg->size) == 0;
+  }
+
+  for (Ssize k = from; k < seg->size; ++k) {
+    if (!glob_set_has_(seg->classes[k], data[k])) return false;
+  }
+
+  return true;
+}
+
+// leftmost occurrence of a segment. a literal one is searched with memchr
+// or horspool, others with shift-and over the first 64 bytes of the segment
+// then a check of the remaining ones.
+static Ssize glob_segment_find_(const struct StrGlobSegment *seg, StrView s) {
+  if (seg->literal != NULL) {
+    if (seg->skip == NULL) {
+      const uint8_t *hit = (const uint8_t*)memchr(s.data, seg->literal[0], (Usize)s.size);
+      return hit != NULL ? hit - s.data : -1;
+    }
+
+    const Ssize m = seg->size;
+    const uint8_t last = seg->literal[m - 1];
+    for (Ssize pos = 0; pos + m <= s.size;) {
+      const uint8_t c = s.data[pos + m - 1];
+      if (c == last && memcmp(s.data + pos, seg->literal, (Usize)(m - 1)) == 0) return pos;
+      pos += seg->skip[c];
+    }
+
+    return -1;
+  }
+
+  const Ssize m = seg->size < 64 ? seg->size : 64;
+  const uint64_t accept = (uint64_t)1 << (m - 1);
+  uint64_t state = 0;
+
+  for (Ssize i = 0; i < s.size; ++i) {
+    state = ((state << 1) | 1) & seg->masks[s.data[i]];
+    if (state & accept) {
+      const Ssize pos = i - m + 1;
+      if (pos + seg->size > s.size) break;
+      if (glob_segment_at_(seg, s.data + pos, m)) return pos;
+    }
+  }
+
+  return -1;
+}
+
+bool StrGlob_match(const StrGlob *glob, StrView s) {
+  const struct StrGlobSegment *seg = glob->segments;
+  const Ssize last = glob->segment_count - 1;
+
+  if (s.size < glob->min_size) return false;
+
+  // text before first '*' and after last '*' are anchored
+  if (!glob_segment_at_(&seg[0], s.data, 0)) return false;
+  if (last == 0) return s.size == seg[0].size;
+  if (!glob_segment_at_(&seg[last], s.data + s.size - seg[last].size, 0)) return false;
+
+  // a leftmost match of each middle segment never prevent the next ones.
+  StrView window = StrView_substr(s, seg[0].size, s.size - seg[0].size - seg[last].size);
+  for (Ssize i = 1; i < last; ++i) {
+    const Ssize pos = glob_segment_find_(&seg[i], window);
+    if (pos < 0) return false;
+    window = StrView_skip(window, pos + seg[i].size);
+  }
+
+  return true;
+}
+
+// a glob set index each glob by one key, found in s at a fixed place for
+// prefix and suffix keys and at any place for middle keys.
+#define GLOB_KEY_PREFIX_       0
+#define GLOB_KEY_SUFFIX_       1
+#define GLOB_KEY_MIDDLE_       2
+#define GLOB_ANCHORED_KEY_MAX_ 16
+#define GLOB_MIDDLE_KEY_MAX_   4
+#define GLOB_FIND_BLOCK_       4096
+
+struct GlobKey_ {
+  int kind;
+  Ssize size;
+  uint8_t bytes[GLOB_ANCHORED_KEY_MAX_];
+};
+
+static Usize glob_key_hash_(int kind, const uint8_t *p, Ssize size) {
+  uint64_t h = 0xCBF29CE484222325ULL ^ (uint64_t)(kind * 32 + size);
+  for (Ssize i = 0; i < size; ++i) {
+    h = (h ^ p[i]) * 0x100000001B3ULL;
+  }
+
+  return (Usize)(h ^ (h >> 32));
+}
+
+// byte at k of a segment when only one value can match there, else -1.
+static int glob_fixed_byte_(const struct StrGlobSegment *seg, Ssize k) {
+  if (seg->literal != NULL) return seg->literal[k];
+
+  int fixed = -1;
+  for (int c = 0; c < 256; ++c) {
+    if (!glob_set_has_(seg->classes[k], (uint8_t)c)) continue;
+    if (fixed >= 0) return -1;
+    fixed = c;
+  }
+
+  return fixed;
+}
+
+// longest of the fixed leading bytes, fixed trailing bytes and run of fixed
+// bytes of a middle segment. size is 0 when the glob has no fixed byte.
+static void glob_key_(const StrGlob *glob, struct GlobKey_ *key) {
+  const struct StrGlobSegment *seg = glob->segments;
+  const Ssize last = glob->segment_count - 1;
+  int c;
+
+  key->kind = GLOB_KEY_PREFIX_;
+  key->size = 0;
+  while (key->size < seg[0].size && key->size < GLOB_ANCHORED_KEY_MAX_
+         && (c = glob_fixed_byte_(&seg[0], key->size)) >= 0) {
+    key->bytes[key->size++] = (uint8_t)c;
+  }
+
+  if (last > 0) {
+    Ssize size = 0;
+    while (size < seg[last].size && size < GLOB_ANCHORED_KEY_MAX_
+           && glob_fixed_byte_(&seg[last], seg[last].size - 1 - size) >= 0) {
+      size++;
+    }
+    if (size > key->size) {
+      key->kind = GLOB_KEY_SUFFIX_;
+      key->size = size;
+      for (Ssize k = 0; k < size; ++k) {
+        key->bytes[k] = (uint8_t)glob_fixed_byte_(&seg[last], seg[last].size - size + k);
+      }
+    }
+  }
+
+  for (Ssize n = 1; n < last && key->size < GLOB_MIDDLE_KEY_MAX_; ++n) {
+    Ssize run = 0;
+    for (Ssize k = 0; k < seg[n].size; ++k) {
+      run = (glob_fixed_byte_(&seg[n], k) >= 0) ? run + 1 : 0;
+      if (run > key->size && run <= GLOB_MIDDLE_KEY_MAX_) {
+        key->kind = GLOB_KEY_MIDDLE_;
+        key->size = run;
+        for (Ssize j = 0; j < run; ++j) {
+          key->bytes[j] = (uint8_t)glob_fixed_byte_(&seg[n], k - run + 1 + j);
+        }
+      }
+    }
+  }
+}
+
+bool StrGlobSet_compile(StrGlobSet *set, const StrView *patterns, Ssize count) {
+  Ssize slot_count = 16;
+  while (slot_count < 2 * count) slot_count *= 2;
+
+  memset(set, 0, sizeof(*set));
+  set->unkeyed = -1;
+  set->slot_mask = slot_count - 1;
+  set->globs = (StrGlob*)STR_VIEW_MALLOC(sizeof(StrGlob) * (Usize)(count > 0 ? count : 1));
+  set->slots = (Ssize*)STR_VIEW_MALLOC(sizeof(Ssize) * (Usize)(slot_count + count));
+  if (set->globs == NULL || set->slots == NULL) {
+    StrGlobSet_free(set);
+    return false;
+  }
+  set->next = set->slots + slot_count;
+  for (Ssize i = 0; i < slot_count; ++i) {
+    set->slots[i] = -1;
+  }
+
+  for (Ssize i = 0; i < count; ++i) {
+    if (!StrGlob_compile(&set->globs[i], patterns[i])) {
+      StrGlobSet_free(set);
+      return false;
+    }
+    set->count++;
+  }
+
+  // link from the last glob so that every list is in index order
+  for (Ssize i = count - 1; i >= 0; --i) {
+    struct GlobKey_ key;
+    glob_key_(&set->globs[i], &key);
+
+    Ssize *head = &set->unkeyed;
+    if (key.size > 0) {
+      head = &set->slots[glob_key_hash_(key.kind, key.bytes, key.size) & (Usize)set->slot_mask];
+      set->key_sizes[key.kind] |= (uint32_t)1 << key.size;
+    }
+    set->next[i] = *head;
+    *head = i;
+  }
+
+  return true;
+}
+
+void StrGlobSet_free(StrGlobSet *set) {
+  for (Ssize i = 0; i < set->count; ++i) {
+    StrGlob_free(&set->globs[i]);
+  }
+  STR_VIEW_FREE(set->globs);
+  STR_VIEW_FREE(set->slots);
+  set->globs = NULL;
+  set->slots = NULL;
+  set->next = NULL;
+  set->count = 0;
+}
+
+// bytes of s as a 256 bit set, used to skip globs missing a literal byte.
+static void glob_present_(StrView s, uint8_t present[32]) {
+  memset(present, 0, 32);
+  for (Ssize i = 0; i < s.size; ++i) {
+    glob_set_add_(present, s.data[i]);
+  }
+}
+
+static bool glob_may_match_(const StrGlob *glob, StrView s, const uint8_t present[32]) {
+  if (s.size < glob->min_size) return false;
+  for (int k = 0; k < 32; ++k) {
+    if (glob->required[k] & ~present[k]) return false;
+  }
+
+  return true;
+}
+
+// set the bits, offset by from, of the globs in [from, to) of the list at i.
+// a glob is in one list only, so a list whose first glob is set is done.
+static void glob_mark_list_(const StrGlobSet *set, Ssize i, Ssize from, Ssize to, uint64_t *bits) {
+  while (i >= 0 && i < from) {
+    i = set->next[i];
+  }
+  if (i < 0 || i >= to || ((bits[(i - from) / 64] >> ((i - from) % 64)) & 1)) return;
+
+  for (; i >= 0 && i < to; i = set->next[i]) {
+    bits[(i - from) / 64] |= (uint64_t)1 << ((i - from) % 64);
+  }
+}
+
+static void glob_mark_key_(const StrGlobSet *set, int kind, const uint8_t *p, Ssize size,
+                           Ssize from, Ssize to, uint64_t *bits) {
+  const Ssize head = set->slots[glob_key_hash_(kind, p, size) & (Usize)set->slot_mask];
+  glob_mark_list_(set, head, from, to, bits);
+}
+
+// match the globs [from, to) whose key is found in s, bits must be cleared
+// and receive the matching ones. return their count.
+static Ssize glob_set_match_(const StrGlobSet *set, StrView s, const uint8_t present[32],
+                             Ssize from, Ssize to, uint64_t *bits) {
+  glob_mark_list_(set, set->unkeyed, from, to, bits);
+  for (Ssize k = 1; k <= GLOB_ANCHORED_KEY_MAX_ && k <= s.size; ++k) {
+    if ((set->key_sizes[GLOB_KEY_PREFIX_] >> k) & 1) {
+      glob_mark_key_(set, GLOB_KEY_PREFIX_, s.data, k, from, to, bits);
+    }
+    if ((set->key_sizes[GLOB_KEY_SUFFIX_] >> k) & 1) {
+      glob_mark_key_(set, GLOB_KEY_SUFFIX_, s.data + s.size - k, k, from, to, bits);
+    }
+  }
+  if (set->key_sizes[GLOB_KEY_MIDDLE_] != 0) {
+    for (Ssize i = 0; i < s.size; ++i) {
+      for (Ssize k = 1; k <= GLOB_MIDDLE_KEY_MAX_ && i + k <= s.size; ++k) {
+        if ((set->key_sizes[GLOB_KEY_MIDDLE_] >> k) & 1) {
+          glob_mark_key_(set, GLOB_KEY_MIDDLE_, s.data + i, k, from, to, bits);
+        }
+      }
+    }
+  }
+
+  // keep the candidates that match
+  Ssize count = 0;
+  for (Ssize w = 0; w < (to - from + 63) / 64; ++w) {
+    uint64_t candidates = bits[w];
+    while (candidates != 0) {
+      const int b = ctz64_(candidates);
+      const StrGlob *glob = &set->globs[from + 64 * w + b];
+      candidates &= candidates - 1;
+      if (glob_may_match_(glob, s, present) && StrGlob_match(glob, s)) {
+        count++;
+      } else {
+        bits[w] &= ~((uint64_t)1 << b);
+      }
+    }
+  }
+
+  return count;
+}
+
+Ssize StrGlobSet_match(const StrGlobSet *set, StrView s, uint64_t *matches) {
+  uint8_t present[32];
+
+  glob_present_(s, present);
+  if (matches != NULL) {
+    memset(matches, 0, sizeof(uint64_t) * (Usize)((set->count + 63) / 64));
+    return glob_set_match_(set, s, present, 0, set->count, matches);
+  }
+
+  Ssize count = 0;
+  for (Ssize from = 0; from < set->count; from += GLOB_FIND_BLOCK_) {
+    uint64_t bits[GLOB_FIND_BLOCK_ / 64] = {0};
+    const Ssize to = (set->count - from < GLOB_FIND_BLOCK_) ? set->count : from + GLOB_FIND_BLOCK_;
+    count += glob_set_match_(set, s, present, from, to, bits);
+  }
+
+  return count;
+}
+
+Ssize StrGlobSet_find(const StrGlobSet *set, StrView s) {
+  uint8_t present[32];
+
+  glob_present_(s, present);
+  for (Ssize from = 0; from < set->count; from += GLOB_FIND_BLOCK_) {
+    uint64_t bits[GLOB_FIND_BLOCK_ / 64] = {0};
+    const Ssize to = (set->count - from < GLOB_FIND_BLOCK_) ? set->count : from + GLOB_FIND_BLOCK_;
+    if (glob_set_match_(set, s, present, from, to, bits) == 0) continue;
+
+    for (Ssize w = 0;; ++w) {
+      if (bits[w] != 0) return from + 64 * w + ctz64_(bits[w]);
+    }
+  }
+
+  return -1;
+}
+
+//----------------------------------------------------------------------------
+// prefix set
+//----------------------------------------------------------------------------
+
+// layout, all integers are native uint32_t:
+//   header: "SVPS" | 1 | key count | total size
+//   node:   value (key index + 1 or 0) | label size | child count
+//           | label bytes | children first byte | pad to 4 | children offsets
+// a child label starts with its branching byte.
+#define PREFIX_HEADER_SIZE_ 16
+#define PREFIX_NODE_SIZE_   12
+
+static uint32_t prefix_get_(const uint8_t *p) {
+  uint32_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static void prefix_put_(uint8_t *p, Usize v) {
+  const uint32_t v32 = (uint32_t)v;
+  memcpy(p, &v32, sizeof(v32));
+}
+
+static int prefix_compare_(const void *a, const void *b) {
+  return StrView_compare(**(const StrView *const *)a, **(const StrView *const *)b);
+}
+
+static Ssize prefix_lcp_(StrView a, StrView b, Ssize from) {
+  Ssize i = from;
+  while (i < a.size && i < b.size && a.data[i] == b.data[i]) {
+    ++i;
+  }
+
+  return i;
+}
+
+static Usize prefix_offsets_(Ssize label_size, Ssize child_count) {
+  return PREFIX_NODE_SIZE_ + (((Usize)(label_size + child_count) + 3) & ~(Usize)3);
+}
+
+// sorted keys[lo, hi) sharing depth bytes, slot is the offset of the child
+// offset to set in the parent, 0 for the root.
+struct PrefixRange_ {
+  Ssize lo;
+  Ssize hi;
+  Ssize depth;
+  Usize slot;
+};
+
+// emit the nodes of count sorted keys, children follow their parent. only
+// measure when out is NULL. pending ranges hold disjoint keys so stack needs
+// count entries at most, however long the shared prefixes are.
+// return the offset after the tree.
+static Usize prefix_build_(const StrView *const *keys, Ssize count, const StrView *base,
+                           struct PrefixRange_ *stack, uint8_t *out) {
+  Usize end = PREFIX_HEADER_SIZE_;
+  Ssize top = 0;
+
+  stack[top].lo = 0;
+  stack[top].hi = count;
+  stack[top].depth = 0;
+  stack[top].slot = 0;
+  top++;
+
+  while (top > 0) {
+    const struct PrefixRange_ range = stack[--top];
+    const StrView first = *keys[range.lo];
+    const Ssize lcp = prefix_lcp_(first, *keys[range.hi - 1], range.depth);
+
+    // keys equal to the common prefix are sorted first
+    Usize value = 0;
+    Ssize i = range.lo;
+    while (i < range.hi && keys[i]->size == lcp) {
+      const Usize index = (Usize)(keys[i] - base) + 1;
+      if (value == 0 || index < value) value = index;
+      ++i;
+    }
+
+    Ssize child_count = 0;
+    for (Ssize j = i; j < range.hi; child_count++) {
+      const uint8_t c = keys[j]->data[lcp];
+      while (j < range.hi && keys[j]->data[lcp] == c) ++j;
+    }
+
+    const Ssize label_size = lcp - range.depth;
+    const Usize at = end;
+    const Usize firsts = at + PREFIX_NODE_SIZE_ + (Usize)label_size;
+    const Usize offsets = at + prefix_offsets_(label_size, child_count);
+    end = offsets + 4 * (Usize)child_count;
+
+    if (out != NULL) {
+      prefix_put_(out + at, value);
+      prefix_put_(out + at + 4, (Usize)label_size);
+      prefix_put_(out + at + 8, (Usize)child_count);
+      if (label_size > 0) memcpy(out + at + PREFIX_NODE_SIZE_, first.data + range.depth, (Usize)label_size);
+      if (range.slot != 0) prefix_put_(out + range.slot, at);
+    }
+
+    // push the last child first so children are emitted in order
+    for (Ssize j = i, k = 0; j < range.hi; ++k) {
+      const uint8_t c = keys[j]->data[lcp];
+      Ssize next = j;
+      while (next < range.hi && keys[next]->data[lcp] == c) ++next;
+
+      if (out != NULL) out[firsts + (Usize)k] = c;
+      struct PrefixRange_ *child = &stack[top + child_count - 1 - k];
+      child->lo = j;
+      child->hi = next;
+      child->depth = lcp;
+      child->slot = offsets + 4 * (Usize)k;
+      j = next;
+    }
+    top += child_count;
+  }
+
+  return end;
+}
+
+bool StrPrefixSet_build(StrPrefixSet *set, const StrView *keys, Ssize count) {
+  const Usize n = (Usize)(count > 0 ? count : 1);
+  struct PrefixRange_ *stack = (struct PrefixRange_*)STR_VIEW_MALLOC((sizeof(struct PrefixRange_) + sizeof(StrView*)) * n);
+  if (stack == NULL) return false;
+  const StrView **sorted = (const StrView**)(stack + n);
+
+  for (Ssize i = 0; i < count; ++i) {
+    sorted[i] = &keys[i];
+  }
+  if (count > 0) qsort(sorted, (Usize)count, sizeof(sorted[0]), prefix_compare_);
+
+  Usize size = PREFIX_HEADER_SIZE_ + PREFIX_NODE_SIZE_;
+  if (count > 0) size = prefix_build_(sorted, count, keys, stack, NULL);
+
+  uint8_t *memory = NULL;
+  if (size <= UINT32_MAX) memory = (uint8_t*)STR_VIEW_MALLOC(size);
+  if (memory == NULL) {
+    STR_VIEW_FREE(stack);
+    return false;
+  }
+
+  memset(memory, 0, size);
+  memcpy(memory, "SVPS", 4);
+  prefix_put_(memory + 4, 1);
+  prefix_put_(memory + 8, (Usize)count);
+  prefix_put_(memory + 12, size);
+  if (count > 0) prefix_build_(sorted, count, keys, stack, memory);
+  STR_VIEW_FREE(stack);
+
+  set->bytes = StrView_from_raw(memory, (Ssize)size);
+  set->count = count;
+  set->memory = memory;
+
+  return true;
+}
+
+bool StrPrefixSet_from_bytes(StrPrefixSet *set, StrView bytes) {
+  if (bytes.size < PREFIX_HEADER_SIZE_ + PREFIX_NODE_SIZE_) return false;
+  if (memcmp(bytes.data, "SVPS", 4) != 0 || prefix_get_(bytes.data + 4) != 1) return false;
+  if (prefix_get_(bytes.data + 12) > (Usize)bytes.size) return false;
+
+  set->bytes = StrView_substr(bytes, 0, prefix_get_(bytes.data + 12));
+  set->count = prefix_get_(bytes.data + 8);
+  set->memory = NULL;
+
+  return true;
+}
+
+StrView StrPrefixSet_bytes(const StrPrefixSet *set) {
+  return set->bytes;
+}
+
+void StrPrefixSet_free(StrPrefixSet *set) {
+  STR_VIEW_FREE(set->memory);
+  set->memory = NULL;
+  set->bytes = StrView_from_raw(NULL, 0);
+  set->count = 0;
+}
+
+// walk the trie along s, store indexes of keys on the path and keep the
+// deepest one. return the number of keys found.
+static Ssize prefix_walk_(const StrPrefixSet *set, StrView s, Ssize *indexes, Ssize capacity,
+                          Ssize *last_index, Ssize *last_size) {
+  const uint8_t *base = set->bytes.data;
+  Usize at = PREFIX_HEADER_SIZE_;
+  Ssize depth = 0;
+  Ssize count = 0;
+
+  for (;;) {
+    const uint8_t *node = base + at;
+    const uint32_t value = prefix_get_(node);
+    const Ssize label_size = prefix_get_(node + 4);
+    const Ssize child_count = prefix_get_(node + 8);
+    const uint8_t *label = node + PREFIX_NODE_SIZE_;
+
+    if (s.size - depth < label_size) break;
+    if (label_size > 0 && memcmp(s.data + depth, label, (Usize)label_size) != 0) break;
+    depth += label_size;
+
+    if (value != 0) {
+      if (count < capacity) indexes[count] = (Ssize)value - 1;
+      *last_index = (Ssize)value - 1;
+      *last_size = depth;
+      count++;
+    }
+    if (depth == s.size || child_count == 0) break;
+
+    const uint8_t *firsts = label + label_size;
+    const uint8_t *hit = (const uint8_t*)memchr(firsts, s.data[depth], (Usize)child_count);
+    if (hit == NULL) break;
+
+    at = prefix_get_(node + prefix_offsets_(label_size, child_count) + 4 * (Usize)(hit - firsts));
+  }
+
+  return count;
+}
+
+Ssize StrPrefixSet_longest(const StrPrefixSet *set, StrView s, Ssize *size) {
+  Ssize index = -1;
+  Ssize last_size = 0;
+
+  prefix_walk_(set, s, NULL, 0, &index, &last_size);
+  if (size != NULL) *size = last_size;
+
+  return index;
+}
+
+Ssize StrPrefixSet_all(const StrPrefixSet *set, StrView s, Ssize *indexes, Ssize capacity) {
+  Ssize index;
+  Ssize size;
+
+  return prefix_walk_(set, s, indexes, capacity, &index, &size);
+}
+
+//----------------------------------------------------------------------------
+// csv
+//----------------------------------------------------------------------------
+
+// bits of sep and eol outside of quotes for the 64 bytes at, inside keeps
+// the quote parity across blocks.
+static uint64_t csv_block_(const StrCsv *csv, Ssize at, uint8_t sep, uint64_t *inside) {
+  const Ssize size = csv->input.size - at;
+  const uint8_t *p = csv->input.data + at;
+  uint8_t tail[64];
+
+  if (size < 64) {
+    memset(tail, 0, sizeof(tail));
+    memcpy(tail, p, (Usize)size);
+    p = tail;
+  }
+
+  const uint64_t quotes = eq_mask64_(p, csv->quote);
+  const uint64_t seps = eq_mask64_(p, sep) | eq_mask64_(p, '\n');
+  const uint64_t quoted = prefix_xor_(quotes) ^ *inside;
+
+  *inside = (uint64_t)0 - (quoted >> 63);
+  uint64_t bits = seps & ~quoted;
+  if (size < 64) bits &= ((uint64_t)1 << size) - 1;
+
+  return bits;
+}
+
+static void csv_load_block_(StrCsv *csv) {
+  csv->bits = csv_block_(csv, csv->block, csv->delimiter, &csv->inside);
+}
+
+// true when the record at csv->pos, whose first bytes were scanned with a
+// previous chunk, ends in this chunk. only the new bytes are searched for
+// its newline, else they are counted as scanned too.
+static bool csv_resume_(StrCsv *csv) {
+  uint64_t inside = csv->scanned_inside;
+  Ssize at = csv->pos + csv->scanned;
+
+  for (; at < csv->input.size; at += 64) {
+    if (csv_block_(csv, at, '\n', &inside) != 0) break;
+  }
+  if (at < csv->input.size || csv->last) {
+    csv->scanned = 0;
+    return true;
+  }
+
+  csv->scanned = csv->input.size - csv->pos;
+  csv->scanned_inside = inside;
+
+  return false;
+}
+
+// position of next separator or newline outside quotes, -1 at end of chunk.
+static Ssize csv_next_sep_(StrCsv *csv) {
+  while (csv->bits == 0) {
+    if (csv->block + 64 >= csv->input.size) return -1;
+    csv->block += 64;
+    csv_load_block_(csv);
+  }
+
+  const Ssize pos = csv->block + (Ssize)ctz64_(csv->bits);
+  csv->bits &= csv->bits - 1;
+
+  return pos;
+}
+
+// field content without quotes, unescaped in scratch only when needed.
+// return false if scratch is too small.
+static bool csv_field_(const StrCsv *csv, StrView raw, StrView *field,
+                       uint8_t *scratch, Ssize scratch_size, Ssize *used) {
+  if (raw.size == 0 || raw.data[0] != csv->quote) {
+    *field = raw;
+    return true;
+  }
+
+  // zero copy when the closing quote is the only one
+  StrView inner = StrView_skip(raw, 1);
+  const Ssize closing = StrView_index_of(inner, csv->quote);
+  if (closing == inner.size - 1) {
+    *field = StrView_substr(inner, 0, closing);
+    return true;
+  }
+
+  if (scratch_size - *used < inner.size) return false;
+
+  uint8_t *out = scratch + *used;
+  Ssize size = 0;
+  Bool quoted = 1;
+  for (Ssize i = 0; i < inner.size; ++i) {
+    const uint8_t c = inner.data[i];
+    if (c != csv->quote) {
+      out[size++] = c;
+    } else if (quoted && i + 1 < inner.size && inner.data[i + 1] == csv->quote) {
+      out[size++] = c;
+      ++i;
+    } else {
+      quoted = !quoted;
+    }
+  }
+  *field = StrView_from_raw(out, size);
+  *used += size;
+
+  return true;
+}
+
+void StrCsv_init(StrCsv *csv, uint8_t delimiter, uint8_t quote) {
+  csv->delimiter = delimiter;
+  csv->quote = quote;
+  csv->scanned = 0;
+  StrCsv_feed(csv, StrView_from_raw(NULL, 0), 0);
+}
+
+void StrCsv_feed(StrCsv *csv, StrView chunk, Bool last) {
+  if (csv->scanned > chunk.size) csv->scanned = 0;
+  csv->input = chunk;
+  csv->last = last;
+  csv->pos = 0;
+  csv->block = 0;
+  csv->inside = 0;
+  csv->bits = 0;
+  if (chunk.size > 0) csv_load_block_(csv);
+}
+
+Ssize StrCsv_next(StrCsv *csv, StrView *fields, Ssize capacity,
+                  uint8_t *scratch, Ssize scratch_size) {
+  const StrCsv saved = *csv;
+  Ssize count = 0;
+  Ssize used = 0;
+  Ssize start = csv->pos;
+
+  if (csv->pos >= csv->input.size) return 0;
+  if (csv->scanned > 0 && !csv_resume_(csv)) return 0;
+
+  for (;;) {
+    Ssize end = csv_next_sep_(csv);
+    const bool eol = (end < 0) || csv->input.data[end] == '\n';
+
+    if (end < 0) {
+      if (!csv->last) {
+        // incomplete record, left for StrCsv_rest. the next chunk resumes
+        // the scan after its bytes, with the quote parity at their end.
+        const uint64_t inside = csv->inside;
+        *csv = saved;
+        csv->scanned = csv->input.size - csv->pos;
+        csv->scanned_inside = inside;
+        return 0;
+      }
+      end = csv->input.size;
+    }
+
+    Ssize field_end = end;
+    if (eol && field_end > start && csv->input.data[field_end - 1] == '\r') field_end--;
+
+    if (count < capacity) {
+      StrView raw = StrView_substr(csv->input, start, field_end - start);
+      if (!csv_field_(csv, raw, &fields[count], scratch, scratch_size, &used)) {
+        *csv = saved;
+        return -1;
+      }
+    }
+    count++;
+    start = end + 1;
+
+    if (eol) {
+      csv->pos = (end < csv->input.size) ? end + 1 : end;
+      return count;
+    }
+  }
+}
+
+StrView StrCsv_rest(const StrCsv *csv) {
+  return StrView_skip(csv->input, csv->pos);
+}
+
+//----------------------------------------------------------------------------
+// escape
+//----------------------------------------------------------------------------
+
+// bit i is set when p[i] is a or b, a control byte or a non ascii byte,
+// for the 32 bytes at p. signed compare to 0x20 catch both last ones.
+static uint32_t escape_mask32_(const uint8_t *p, uint8_t a, uint8_t b) {
+#if defined(__AVX2__)
+  const __m256i x = _mm256_loadu_si256((const __m256i*)p);
+  __m256i m = _mm256_cmpgt_epi8(_mm256_set1_epi8(0x20), x);
+  m = _mm256_or_si256(m, _mm256_cmpeq_epi8(x, _mm256_set1_epi8((char)a)));
+  m = _mm256_or_si256(m, _mm256_cmpeq_epi8(x, _mm256_set1_epi8((char)b)));
+  return (uint32_t)_mm256_movemask_epi8(m);
+#elif defined(__SSE2__)
+  uint32_t mask = 0;
+  for (int i = 0; i < 2; ++i) {
+    const __m128i x = _mm_loadu_si128((const __m128i*)(p + 16 * i));
+    __m128i m = _mm_cmplt_epi8(x, _mm_set1_epi8(0x20));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(x, _mm_set1_epi8((char)a)));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(x, _mm_set1_epi8((char)b)));
+    mask |= (uint32_t)(uint16_t)_mm_movemask_epi8(m) << (16 * i);
+  }
+  return mask;
+#else
+  uint32_t mask = 0;
+  for (int i = 0; i < 32; ++i) {
+    mask |= (uint32_t)((int8_t)p[i] < 0x20 || p[i] == a || p[i] == b) << i;
+  }
+  return mask;
+#endif
+}
+
+// size of the leading run of bytes that are not special for escape_mask32_.
+static Ssize escape_run_(const uint8_t *p, Ssize size, uint8_t a, uint8_t b) {
+  Ssize i = 0;
+
+  for (; i + 32 <= size; i += 32) {
+    const uint32_t mask = escape_mask32_(p + i, a, b);
+    if (mask != 0) return i + ctz64_(mask);
+  }
+  for (; i < size; ++i) {
+    if ((int8_t)p[i] < 0x20 || p[i] == a || p[i] == b) break;
+  }
+
+  return i;
+}
+
+static int encode_utf8_(int32_t c, uint8_t out[4]) {
+  if (c < 0x80) {
+    out[0] = (uint8_t)c;
+    return 1;
+  }
+  if (c < 0x800) {
+    out[0] = (uint8_t)(0xC0 | (c >> 6));
+    out[1] = (uint8_t)(0x80 | (c & 0x3F));
+    return 2;
+  }
+  if (c < 0x10000) {
+    out[0] = (uint8_t)(0xE0 | (c >> 12));
+    out[1] = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+    out[2] = (uint8_t)(0x80 | (c & 0x3F));
+    return 3;
+  }
+  out[0] = (uint8_t)(0xF0 | (c >> 18));
+  out[1] = (uint8_t)(0x80 | ((c >> 12) & 0x3F));
+  out[2] = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+  out[3] = (uint8_t)(0x80 | (c & 0x3F));
+  return 4;
+}
+
+// append bytes to out while they fit, return new size.
+static Ssize escape_put_(uint8_t *out, Ssize capacity, Ssize size, const void *bytes, Ssize count) {
+  if (size + count <= capacity) memcpy(out + size, bytes, (Usize)count);
+  return size + count;
+}
+
+// offset of first byte that escape has to rewrite, s.size if none.
+static Ssize escape_first_(StrView s) {
+  Ssize i = 0;
+
+  for (;;) {
+    i += escape_run_(s.data + i, s.size - i, '"', '\\');
+    if (i == s.size || s.data[i] < 0x80) return i;
+
+    const struct CodeResult cr = StrView_try_decode(StrView_skip(s, i));
+    if (cr.codepoint == CODEPOINT_INVALID) return i;
+    i += cr.size;
+  }
+}
+
+// size of the invalid utf8 sequence at s[i]: its lead byte and the
+// continuation bytes present, at most as many as the lead announces.
+static Ssize escape_invalid_size_(StrView s, Ssize i) {
+  const uint8_t lead = s.data[i];
+  const Ssize expected = (lead >= 0xF0 && lead <= 0xF4) ? 4 : (lead >= 0xE0 && lead <= 0xEF) ? 3
+                       : (lead >= 0xC2 && lead <= 0xDF) ? 2 : 1;
+  Ssize size = 1;
+
+  while (size < expected && i + size < s.size && (s.data[i + size] & 0xC0) == 0x80) ++size;
+
+  return size;
+}
+
+// escape s from offset i, size bytes being already in out.
+// return size of the whole escaped content.
+static Ssize escape_(StrView s, enum StrEscape kind, Ssize i, uint8_t *out, Ssize capacity, Ssize size) {
+  static const char hex[] = "0123456789abcdef";
+
+  while (i < s.size) {
+    const Ssize run = escape_run_(s.data + i, s.size - i, '"', '\\');
+    size = escape_put_(out, capacity, size, s.data + i, run);
+    i += run;
+    if (i == s.size) break;
+
+    const uint8_t c = s.data[i];
+    if (c >= 0x80) {
+      const struct CodeResult cr = StrView_try_decode(StrView_skip(s, i));
+      if (cr.codepoint != CODEPOINT_INVALID) {
+        size = escape_put_(out, capacity, size, s.data + i, cr.size);
+        i += cr.size;
+      } else if (kind == STR_ESCAPE_JSON) {
+        // one replacement for the whole invalid sequence
+        size = escape_put_(out, capacity, size, "\\ufffd", 6);
+        i += escape_invalid_size_(s, i);
+      } else {
+        const char octal[4] = {'\\', (char)('0' + (c >> 6)), (char)('0' + ((c >> 3) & 7)), (char)('0' + (c & 7))};
+        size = escape_put_(out, capacity, size, octal, 4);
+        i += 1;
+      }
+      continue;
+    }
+
+    char short_escape = 0;
+    switch (c) {
+      case '"':  short_escape = '"';  break;
+      case '\\': short_escape = '\\'; break;
+      case '\b': short_escape = 'b';  break;
+      case '\f': short_escape = 'f';  break;
+      case '\n': short_escape = 'n';  break;
+      case '\r': short_escape = 'r';  break;
+      case '\t': short_escape = 't';  break;
+      case '\a': short_escape = (kind == STR_ESCAPE_C) ? 'a' : 0; break;
+      case '\v': short_escape = (kind == STR_ESCAPE_C) ? 'v' : 0; break;
+    }
+
+    if (short_escape != 0) {
+      const char escape[2] = {'\\', short_escape};
+      size = escape_put_(out, capacity, size, escape, 2);
+    } else if (kind == STR_ESCAPE_JSON) {
+      const char escape[6] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF]};
+      size = escape_put_(out, capacity, size, escape, 6);
+    } else {
+      const char octal[4] = {'\\', (char)('0' + (c >> 6)), (char)('0' + ((c >> 3) & 7)), (char)('0' + (c & 7))};
+      size = escape_put_(out, capacity, size, octal, 4);
+    }
+    i += 1;
+  }
+
+  return size;
+}
+
+Ssize StrView_escape_size(StrView s, enum StrEscape kind) {
+  const Ssize first = escape_first_(s);
+  return escape_(s, kind, first, NULL, 0, first);
+}
+
+StrView StrView_escape(StrView s, enum StrEscape kind, uint8_t *out, Ssize capacity) {
+  const Ssize first = escape_first_(s);
+  if (first == s.size) return s;
+
+  escape_put_(out, capacity, 0, s.data, first);
+  const Ssize size = escape_(s, kind, first, out, capacity, first);
+  if (size > capacity) return StrView_from_raw(NULL, -size);
+
+  return StrView_from_raw(out, size);
+}
+
+static int hex_value_(uint8_t c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// value of count hex digits at s[i], -1 if any is missing or not hex or
+// the value is above 0x10FFFF. surrogates are left to the caller.
+static int32_t unescape_hex_(StrView s, Ssize i, int count) {
+  uint32_t value = 0;
+
+  if (s.size - i < count) return -1;
+  for (int k = 0; k < count; ++k) {
+    const int digit = hex_value_(s.data[i + k]);
+    if (digit < 0) return -1;
+    value = (value << 4) | (uint32_t)digit;
+    if (value > 0x10FFFF) return -1;
+  }
+
+  return (int32_t)value;
+}
+
+// decode the escape at s[i], s[i] being '\\'. write its bytes to out and
+// return the escape size, 0 if invalid.
+static Ssize unescape_one_(StrView s, Ssize i, enum StrEscape kind, uint8_t out[4], int *out_size) {
+  static const char json_simple[] = "\"\"\\\\//b\bf\fn\nr\rt\t";
+  static const char c_simple[] = "\"\"\\\\''??a\ab\bf\fn\nr\rt\tv\v";
+  const char *simple = (kind == STR_ESCAPE_JSON) ? json_simple : c_simple;
+
+  if (i + 1 >= s.size) return 0;
+  const uint8_t e = s.data[i + 1];
+
+  for (const char *p = simple; *p != 0; p += 2) {
+    if (e == (uint8_t)p[0]) {
+      out[0] = (uint8_t)p[1];
+      *out_size = 1;
+      return 2;
+    }
+  }
+
+  if (e == 'u' || (e == 'U' && kind == STR_ESCAPE_C)) {
+    const int digits = (e == 'u') ? 4 : 8;
+    int32_t c = unescape_hex_(s, i + 2, digits);
+    Ssize size = 2 + digits;
+    if (c < 0) return 0;
+
+    if (kind == STR_ESCAPE_JSON && c >= 0xD800 && c <= 0xDBFF) {
+      // high surrogate must be followed by a low one
+      if (i + 12 > s.size || s.data[i + 6] != '\\' || s.data[i + 7] != 'u') return 0;
+      const int32_t low = unescape_hex_(s, i + 8, 4);
+      if (low < 0xDC00 || low > 0xDFFF) return 0;
+      c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+      size = 12;
+    }
+    if ((c >= 0xD800 && c <= 0xDFFF) || c > 0x10FFFF) return 0;
+
+    *out_size = encode_utf8_(c, out);
+    return size;
+  }
+
+  if (kind == STR_ESCAPE_C && e >= '0' && e <= '7') {
+    int value = 0;
+    Ssize size = 1;
+    while (size < 4 && i + size < s.size && s.data[i + size] >= '0' && s.data[i + size] <= '7') {
+      value = value * 8 + (s.data[i + size] - '0');
+      size++;
+    }
+    if (value > 0xFF) return 0;
+
+    out[0] = (uint8_t)value;
+    *out_size = 1;
+    return size;
+  }
+
+  if (kind == STR_ESCAPE_C && e == 'x') {
+    int value = 0;
+    Ssize size = 2;
+    while (i + size < s.size && hex_value_(s.data[i + size]) >= 0) {
+      value = value * 16 + hex_value_(s.data[i + size]);
+      if (value > 0xFF) return 0;
+      size++;
+    }
+    if (size == 2) return 0;
+
+    out[0] = (uint8_t)value;
+    *out_size = 1;
+    return size;
+  }
+
+  return 0;
+}
+
+StrView StrView_unescape(StrView s, enum StrEscape kind, uint8_t *out, Ssize capacity) {
+  Ssize size = 0;
+  Ssize i = 0;
+  bool copy = false;
+
+  while (i < s.size) {
+    const Ssize run = escape_run_(s.data + i, s.size - i, '\\', '\\');
+    if (copy) memcpy(out + size, s.data + i, (Usize)run);
+    size += run;
+    i += run;
+    if (i == s.size) break;
+
+    const uint8_t c = s.data[i];
+    if (c >= 0x80) {
+      const struct CodeResult cr = StrView_try_decode(StrView_skip(s, i));
+      if (cr.codepoint == CODEPOINT_INVALID) return StrView_from_raw(NULL, -1 - i);
+      if (copy) memcpy(out + size, s.data + i, (Usize)cr.size);
+      size += cr.size;
+      i += cr.size;
+    } else if (c != '\\') {
+      if (kind == STR_ESCAPE_JSON) return StrView_from_raw(NULL, -1 - i);
+      if (copy) out[size] = c;
+      size++;
+      i++;
+    } else {
+      uint8_t bytes[4];
+      int count;
+      const Ssize escape_size = unescape_one_(s, i, kind, bytes, &count);
+      if (escape_size == 0) return StrView_from_raw(NULL, -1 - i);
+
+      // first escape, start to copy
+      if (!copy) {
+        if (capacity < s.size) return StrView_from_raw(NULL, -1 - s.size);
+        memcpy(out, s.data, (Usize)size);
+        copy = true;
+      }
+      memcpy(out + size, bytes, (Usize)count);
+      size += count;
+      i += escape_size;
+    }
+  }
+
+  return copy ? StrView_from_raw(out, size) : s;
+}
+
+//----------------------------------------------------------------------------
+// hex and base64
+//----------------------------------------------------------------------------
+
+Ssize StrView_hex_encode_size(StrView s) {
+  return 2 * s.size;
+}
+
+StrView StrView_hex_encode(StrView s, uint8_t *out, Ssize capacity) {
+  static const char digits[] = "0123456789abcdef";
+  Ssize i = 0;
+
+  assert(capacity >= StrView_hex_encode_size(s));
+  (void)capacity;
+
+#if defined(__SSE2__)
+  // nibbles to ascii: '0' + n, plus 39 more when n > 9
+  const __m128i mask = _mm_set1_epi8(0x0F);
+  const __m128i nine = _mm_set1_epi8(9);
+  for (; i + 16 <= s.size; i += 16) {
+    const __m128i x = _mm_loadu_si128((const __m128i*)(s.data + i));
+    __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), mask);
+    __m128i lo = _mm_and_si128(x, mask);
+    hi = _mm_add_epi8(_mm_add_epi8(hi, _mm_set1_epi8('0')), _mm_and_si128(_mm_cmpgt_epi8(hi, nine), _mm_set1_epi8(39)));
+    lo = _mm_add_epi8(_mm_add_epi8(lo, _mm_set1_epi8('0')), _mm_and_si128(_mm_cmpgt_epi8(lo, nine), _mm_set1_epi8(39)));
+    _mm_storeu_si128((__m128i*)(out + 2 * i), _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128((__m128i*)(out + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+  }
+#endif
+
+  for (; i < s.size; ++i) {
+    out[2 * i] = (uint8_t)digits[s.data[i] >> 4];
+    out[2 * i + 1] = (uint8_t)digits[s.data[i] & 0xF];
+  }
+
+  return StrView_from_raw(out, 2 * s.size);
+}
+
+Ssize StrView_hex_decode_size(StrView s) {
+  return s.size / 2;
+}
+
+StrView StrView_hex_decode(StrView s, uint8_t *out, Ssize capacity) {
+  Ssize i = 0;
+
+  assert(capacity >= StrView_hex_decode_size(s));
+  (void)capacity;
+
+#if defined(__SSE2__)
+  // digit value per byte, with 0x80 set on invalid bytes
+  for (; i + 32 <= s.size; i += 32) {
+    __m128i values[2];
+    int invalid = 0;
+    for (int k = 0; k < 2; ++k) {
+      const __m128i x = _mm_loadu_si128((const __m128i*)(s.data + i + 16 * k));
+      const __m128i digit = _mm_sub_epi8(x, _mm_set1_epi8('0'));
+      const __m128i letter = _mm_sub_epi8(_mm_or_si128(x, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+      const __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(digit, _mm_set1_epi8(-1)), _mm_cmplt_epi8(digit, _mm_set1_epi8(10)));
+      const __m128i is_letter = _mm_and_si128(_mm_cmpgt_epi8(letter, _mm_set1_epi8(-1)), _mm_cmplt_epi8(letter, _mm_set1_epi8(6)));
+      invalid |= _mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) ^ 0xFFFF;
+      values[k] = _mm_or_si128(_mm_and_si128(is_digit, digit),
+                               _mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+    }
+    if (invalid) break;
+
+    // first digit of a pair is the high nibble
+    const __m128i lo_mask = _mm_set1_epi16(0x00FF);
+    const __m128i a = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values[0], lo_mask), 4), _mm_srli_epi16(values[0], 8));
+    const __m128i b = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values[1], lo_mask), 4), _mm_srli_epi16(values[1], 8));
+    _mm_storeu_si128((__m128i*)(out + i / 2), _mm_packus_epi16(a, b));
+  }
+#endif
+
+  for (; i + 1 < s.size; i += 2) {
+    const int hi = hex_value_(s.data[i]);
+    const int lo = hex_value_(s.data[i + 1]);
+    if (hi < 0) return StrView_from_raw(NULL, -1 - i);
+    if (lo < 0) return StrView_from_raw(NULL, -2 - i);
+    out[i / 2] = (uint8_t)((hi << 4) | lo);
+  }
+  if (i < s.size) return StrView_from_raw(NULL, -1 - i);
+
+  return StrView_from_raw(out, s.size / 2);
+}
+
+static int base64_value_(uint8_t c, int flags) {
+  const bool url = (flags & STR_BASE64_URL) != 0;
+
+  if (c >= 'A' && c <= 'Z') return c - 'A';
+  if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+  if (c >= '0' && c <= '9') return c - '0' + 52;
+  if (c == (url ? '-' : '+')) return 62;
+  if (c == (url ? '_' : '/')) return 63;
+
+  return -1;
+}
+
+#if defined(__AVX2__)
+// 24 bytes at p to 32 characters, reads 28 bytes.
+static void base64_encode32_(const uint8_t *p, uint8_t *out, bool url) {
+  const __m128i lo = _mm_loadu_si128((const __m128i*)p);
+  const __m128i hi = _mm_loadu_si128((const __m128i*)(p + 12));
+  __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+  // split each 3 bytes in four 6 bits indices
+  in = _mm256_shuffle_epi8(in, _mm256_set_epi8(
+      10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+      10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+  const __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+  const __m256i indices = _mm256_or_si256(t0, t1);
+
+  // offset to add to each index, selected by its range
+  const char c62 = url ? '-' : '+';
+  const char c63 = url ? '_' : '/';
+  const __m256i shift = _mm256_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, (char)(c62 - 62), (char)(c63 - 63), 'A', 0, 0,
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, (char)(c62 - 62), (char)(c63 - 63), 'A', 0, 0);
+  __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+  range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+  const __m256i chars = _mm256_add_epi8(_mm256_shuffle_epi8(shift, range), indices);
+
+  _mm256_storeu_si256((__m256i*)out, chars);
+}
+
+// 32 characters at p to 24 bytes, return false on invalid character.
+static bool base64_decode32_(const uint8_t *p, uint8_t *out, bool url) {
+  __m256i in = _mm256_loadu_si256((const __m256i*)p);
+
+  if (url) {
+    // reject "+/" then map "-_" to them
+    const __m256i plus = _mm256_cmpeq_epi8(in, _mm256_set1_epi8('+'));
+    const __m256i slash = _mm256_cmpeq_epi8(in, _mm256_set1_epi8('/'));
+    if (!_mm256_testz_si256(_mm256_or_si256(plus, slash), _mm256_or_si256(plus, slash))) return false;
+    in = _mm256_blendv_epi8(in, _mm256_set1_epi8('+'), _mm256_cmpeq_epi8(in, _mm256_set1_epi8('-')));
+    in = _mm256_blendv_epi8(in, _mm256_set1_epi8('/'), _mm256_cmpeq_epi8(in, _mm256_set1_epi8('_')));
+  }
+
+  const __m256i lut_lo = _mm256_setr_epi8(
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+  const __m256i lut_hi = _mm256_setr_epi8(
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  const __m256i lut_roll = _mm256_setr_epi8(
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m256i mask_2F = _mm256_set1_epi8(0x2F);
+
+  const __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), mask_2F);
+  const __m256i lo_nibbles = _mm256_and_si256(in, mask_2F);
+  const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+  const __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+  if (!_mm256_testz_si256(lo, hi)) return false;
+
+  const __m256i eq_2F = _mm256_cmpeq_epi8(in, mask_2F);
+  const __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_2F, hi_nibbles));
+  const __m256i values = _mm256_add_epi8(in, roll);
+
+  // pack four 6 bits values in 3 bytes
+  const __m256i ab_bc = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+  __m256i bytes = _mm256_madd_epi16(ab_bc, _mm256_set1_epi32(0x00011000));
+  bytes = _mm256_shuffle_epi8(bytes, _mm256_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+  bytes = _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+
+  _mm_storeu_si128((__m128i*)out, _mm256_castsi256_si128(bytes));
+  _mm_storel_epi64((__m128i*)(out + 16), _mm256_extracti128_si256(bytes, 1));
+
+  return true;
+}
+#elif defined(__SSSE3__)
+// 12 bytes at p to 16 characters, reads 16 bytes.
+static void base64_encode16_(const uint8_t *p, uint8_t *out, bool url) {
+  __m128i in = _mm_loadu_si128((const __m128i*)p);
+
+  in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  const __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+  const __m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+  const __m128i indices = _mm_or_si128(t0, t1);
+
+  const char c62 = url ? '-' : '+';
+  const char c63 = url ? '_' : '/';
+  const __m128i shift = _mm_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+      '0' - 52, '0' - 52, '0' - 52, (char)(c62 - 62), (char)(c63 - 63), 'A', 0, 0);
+  __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+  range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+  const __m128i chars = _mm_add_epi8(_mm_shuffle_epi8(shift, range), indices);
+
+  _mm_storeu_si128((__m128i*)out, chars);
+}
+
+// 16 characters at p to 12 bytes, return false on invalid character.
+static bool base64_decode16_(const uint8_t *p, uint8_t *out, bool url) {
+  __m128i in = _mm_loadu_si128((const __m128i*)p);
+
+  if (url) {
+    const __m128i plus = _mm_cmpeq_epi8(in, _mm_set1_epi8('+'));
+    const __m128i slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+    if (_mm_movemask_epi8(_mm_or_si128(plus, slash)) != 0) return false;
+    const __m128i minus = _mm_cmpeq_epi8(in, _mm_set1_epi8('-'));
+    const __m128i underscore = _mm_cmpeq_epi8(in, _mm_set1_epi8('_'));
+    in = _mm_or_si128(_mm_andnot_si128(minus, in), _mm_and_si128(minus, _mm_set1_epi8('+')));
+    in = _mm_or_si128(_mm_andnot_si128(underscore, in), _mm_and_si128(underscore, _mm_set1_epi8('/')));
+  }
+
+  const __m128i lut_lo = _mm_setr_epi8(
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+  const __m128i lut_hi = _mm_setr_epi8(
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  const __m128i lut_roll = _mm_setr_epi8(
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m128i mask_2F = _mm_set1_epi8(0x2F);
+
+  const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(in, 4), mask_2F);
+  const __m128i lo_nibbles = _mm_and_si128(in, mask_2F);
+  const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+  const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+  if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0xFFFF) return false;
+
+  const __m128i eq_2F = _mm_cmpeq_epi8(in, mask_2F);
+  const __m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_2F, hi_nibbles));
+  const __m128i values = _mm_add_epi8(in, roll);
+
+  const __m128i ab_bc = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+  __m128i bytes = _mm_madd_epi16(ab_bc, _mm_set1_epi32(0x00011000));
+  bytes = _mm_shuffle_epi8(bytes, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+  _mm_storel_epi64((__m128i*)out, bytes);
+  const uint32_t last = (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(bytes, 8));
+  memcpy(out + 8, &last, 4);
+
+  return true;
+}
+#endif
+
+Ssize StrView_base64_encode_size(StrView s, int flags) {
+  if (flags & STR_BASE64_NOPAD) {
+    const Ssize rest = s.size % 3;
+    return s.size / 3 * 4 + (rest ? rest + 1 : 0);
+  }
+
+  return (s.size + 2) / 3 * 4;
+}
+
+StrView StrView_base64_encode(StrView s, int flags, uint8_t *out, Ssize capacity) {
+  const bool url = (flags & STR_BASE64_URL) != 0;
+  const char *alphabet = url ? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"
+                             : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  Ssize i = 0;
+  Ssize size = 0;
+
+  assert(capacity >= StrView_base64_encode_size(s, flags));
+  (void)capacity;
+
+#if defined(__AVX2__)
+  for (; i + 28 <= s.size; i += 24, size += 32) {
+    base64_encode32_(s.data + i, out + size, url);
+  }
+#elif defined(__SSSE3__)
+  for (; i + 16 <= s.size; i += 12, size += 16) {
+    base64_encode16_(s.data + i, out + size, url);
+  }
+#endif
+
+  for (; i + 3 <= s.size; i += 3, size += 4) {
+    const uint32_t v = (uint32_t)s.data[i] << 16 | (uint32_t)s.data[i + 1] << 8 | s.data[i + 2];
+    out[size]     = (uint8_t)alphabet[v >> 18];
+    out[size + 1] = (uint8_t)alphabet[(v >> 12) & 0x3F];
+    out[size + 2] = (uint8_t)alphabet[(v >> 6) & 0x3F];
+    out[size + 3] = (uint8_t)alphabet[v & 0x3F];
+  }
+
+  if (i < s.size) {
+    const uint32_t v = (uint32_t)s.data[i] << 16 | (i + 1 < s.size ? (uint32_t)s.data[i + 1] << 8 : 0);
+    out[size++] = (uint8_t)alphabet[v >> 18];
+    out[size++] = (uint8_t)alphabet[(v >> 12) & 0x3F];
+    if (i + 1 < s.size) out[size++] = (uint8_t)alphabet[(v >> 6) & 0x3F];
+    if (!(flags & STR_BASE64_NOPAD)) {
+      while (size % 4 != 0) out[size++] = '=';
+    }
+  }
+
+  return StrView_from_raw(out, size);
+}
+
+Ssize StrView_base64_decode_size(StrView s, int flags) {
+  Ssize size = s.size;
+
+  if (!(flags & STR_BASE64_NOPAD)) {
+    if (size > 0 && s.data[size - 1] == '=') size--;
+    if (size > 0 && s.data[size - 1] == '=') size--;
+  }
+
+  return size / 4 * 3 + (size % 4 ? size % 4 - 1 : 0);
+}
+
+StrView StrView_base64_decode(StrView s, int flags, uint8_t *out, Ssize capacity) {
+  Ssize i = 0;
+  Ssize size = 0;
+
+  assert(capacity >= StrView_base64_decode_size(s, flags));
+  (void)capacity;
+
+  // characters before the padding
+  Ssize end = s.size;
+  if (!(flags & STR_BASE64_NOPAD)) {
+    if (s.size % 4 != 0) return StrView_from_raw(NULL, -1 - (s.size - s.size % 4));
+    if (end > 0 && s.data[end - 1] == '=') end--;
+    if (end > 0 && s.data[end - 1] == '=') end--;
+  }
+  if (end % 4 == 1) return StrView_from_raw(NULL, -end);
+
+  // the vector kernels stop at the first block with an invalid character,
+  // the scalar loop then locate it.
+#if defined(__AVX2__)
+  for (; i + 32 <= end; i += 32, size += 24) {
+    if (!base64_decode32_(s.data + i, out + size, (flags & STR_BASE64_URL) != 0)) break;
+  }
+#elif defined(__SSSE3__)
+  for (; i + 16 <= end; i += 16, size += 12) {
+    if (!base64_decode16_(s.data + i, out + size, (flags & STR_BASE64_URL) != 0)) break;
+  }
+#endif
+
+  uint32_t v = 0;
+  int count = 0;
+  for (; i < end; ++i) {
+    const int value = base64_value_(s.data[i], flags);
+    if (value < 0) return StrView_from_raw(NULL, -1 - i);
+
+    v = (v << 6) | (uint32_t)value;
+    if (++count == 4) {
+      out[size]     = (uint8_t)(v >> 16);
+      out[size + 1] = (uint8_t)(v >> 8);
+      out[size + 2] = (uint8_t)v;
+      size += 3;
+      v = 0;
+      count = 0;
+    }
+  }
+
+  // partial group, its unused low bits must be zero
+  if (count == 2) {
+    if (v & 0xF) return StrView_from_raw(NULL, -end);
+    out[size++] = (uint8_t)(v >> 4);
+  } else if (count == 3) {
+    if (v & 0x3) return StrView_from_raw(NULL, -end);
+    out[size++] = (uint8_t)(v >> 10);
+    out[size++] = (uint8_t)(v >> 2);
+  }
+
+  return StrView_from_raw(out, size);
+}
+
+//----------------------------------------------------------------------------
+// edit distance
+//----------------------------------------------------------------------------
+
+// Myers bit vectors of a pattern split in blocks of 64 symbols (Hyyro).
+// symbols are bytes or codepoints, peq has one row per distinct symbol plus
+// a zero row for symbols missing from the pattern.
+struct EditPattern_ {
+  Ssize size;
+  Ssize blocks;
+  Ssize symbol_count;
+  uint64_t last;
+  int32_t *symbols;
+  uint64_t *peq;
+  uint64_t *pv;
+  uint64_t *mv;
+  int32_t low[256];
+  void *memory[2];
+  int32_t small_symbols[64];
+  uint64_t small_peq[65];
+  uint64_t small_pv;
+  uint64_t small_mv;
+};
+
+static int32_t edit_symbol_(StrView s, Ssize *pos, bool utf8) {
+  if (!utf8) return s.data[(*pos)++];
+
+  const UTF8View s8 = {s.data + *pos, s.size - *pos};
+  const struct CodeResult cr = UTF8View_get_codepoint(s8);
+  *pos += cr.size;
+
+  return cr.codepoint;
+}
+
+static int edit_compare_(const void *a, const void *b) {
+  const int32_t x = *(const int32_t*)a;
+  const int32_t y = *(const int32_t*)b;
+  return (x > y) - (x < y);
+}
+
+static Ssize edit_index_(const struct EditPattern_ *e, int32_t c) {
+  if (c < 256) return e->low[c];
+
+  Ssize lo = 0;
+  Ssize hi = e->symbol_count;
+  while (lo < hi) {
+    const Ssize mid = lo + (hi - lo) / 2;
+    if (e->symbols[mid] < c) lo = mid + 1;
+    else hi = mid;
+  }
+
+  return (lo < e->symbol_count && e->symbols[lo] == c) ? lo : e->symbol_count;
+}
+
+static void edit_reset_(struct EditPattern_ *e) {
+  for (Ssize b = 0; b < e->blocks; ++b) {
+    e->pv[b] = ~(uint64_t)0;
+    e->mv[b] = 0;
+  }
+}
+
+static void edit_free_(struct EditPattern_ *e) {
+  STR_VIEW_FREE(e->memory[0]);
+  STR_VIEW_FREE(e->memory[1]);
+}
+
+// build pattern bit vectors of size symbols of p, optionally reversed
+// (bytes only). return false on allocation failure.
+static bool edit_init_(struct EditPattern_ *e, StrView p, Ssize size, bool utf8, bool reverse) {
+  e->size = size;
+  e->blocks = (size + 63) / 64;
+  e->last = (uint64_t)1 << ((size - 1) % 64);
+  e->memory[0] = NULL;
+  e->memory[1] = NULL;
+
+  e->symbols = e->small_symbols;
+  if (size > 64) {
+    e->symbols = (int32_t*)STR_VIEW_MALLOC(sizeof(int32_t) * (Usize)size);
+    e->memory[0] = e->symbols;
+    if (e->symbols == NULL) return false;
+  }
+
+  // sorted distinct symbols
+  for (Ssize i = 0, pos = 0; i < size; ++i) {
+    e->symbols[i] = edit_symbol_(p, &pos, utf8);
+  }
+  qsort(e->symbols, (Usize)size, sizeof(int32_t), edit_compare_);
+  e->symbol_count = 0;
+  for (Ssize i = 0; i < size; ++i) {
+    if (i == 0 || e->symbols[i] != e->symbols[i - 1]) e->symbols[e->symbol_count++] = e->symbols[i];
+  }
+
+  const Usize words = (Usize)((e->symbol_count + 1) * e->blocks);
+  e->peq = e->small_peq;
+  e->pv = &e->small_pv;
+  e->mv = &e->small_mv;
+  if (size > 64) {
+    e->peq = (uint64_t*)STR_VIEW_MALLOC(sizeof(uint64_t) * (words + 2 * (Usize)e->blocks));
+    e->memory[1] = e->peq;
+    if (e->peq == NULL) {
+      edit_free_(e);
+      return false;
+    }
+    e->pv = e->peq + words;
+    e->mv = e->pv + e->blocks;
+  }
+  memset(e->peq, 0, sizeof(uint64_t) * words);
+
+  // direct index of symbols below 256
+  for (int c = 0; c < 256; ++c) {
+    e->low[c] = (int32_t)e->symbol_count;
+  }
+  for (Ssize i = 0; i < e->symbol_count && e->symbols[i] < 256; ++i) {
+    e->low[e->symbols[i]] = (int32_t)i;
+  }
+
+  for (Ssize i = 0, pos = 0; i < size; ++i) {
+    const int32_t c = reverse ? p.data[size - 1 - i] : edit_symbol_(p, &pos, utf8);
+    e->peq[edit_index_(e, c) * e->blocks + i / 64] |= (uint64_t)1 << (i % 64);
+  }
+  edit_reset_(e);
+
+  return true;
+}
+
+// advance one text symbol, hin is +1 for a global alignment and 0 for a
+// search. return the score delta of the last pattern row.
+static int edit_step_(struct EditPattern_ *e, int32_t c, int hin) {
+  const uint64_t *eq_row = e->peq + edit_index_(e, c) * e->blocks;
+
+  for (Ssize b = 0; b < e->blocks; ++b) {
+    const uint64_t pv = e->pv[b];
+    const uint64_t mv = e->mv[b];
+    uint64_t eq = eq_row[b];
+    const uint64_t xv = eq | mv;
+    if (hin < 0) eq |= 1;
+
+    const uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+    uint64_t ph = mv | ~(xh | pv);
+    uint64_t mh = pv & xh;
+
+    const uint64_t high = (b == e->blocks - 1) ? e->last : (uint64_t)1 << 63;
+    const int hout = (ph & high) ? 1 : (mh & high) ? -1 : 0;
+
+    ph <<= 1;
+    mh <<= 1;
+    if (hin < 0) mh |= 1;
+    else if (hin > 0) ph |= 1;
+
+    e->pv[b] = mh | ~(xv | ph);
+    e->mv[b] = ph & xv;
+    hin = hout;
+  }
+
+  return hin;
+}
+
+static Ssize edit_distance_(StrView s1, StrView s2, bool utf8, Ssize max) {
+  const UTF8View u1 = {s1.data, s1.size};
+  const UTF8View u2 = {s2.data, s2.size};
+  Ssize n1 = utf8 ? UTF8View_count_codepoint(u1) : s1.size;
+  Ssize n2 = utf8 ? UTF8View_count_codepoint(u2) : s2.size;
+
+  // shorter one is the pattern
+  if (n1 > n2) {
+    const StrView s = s1;
+    const Ssize n = n1;
+    s1 = s2;
+    n1 = n2;
+    s2 = s;
+    n2 = n;
+  }
+  if (n2 - n1 > max) return -1;
+  if (n1 == 0) return n2;
+
+  struct EditPattern_ e;
+  if (!edit_init_(&e, s1, n1, utf8, false)) return -1;
+
+  Ssize score = n1;
+  Ssize pos = 0;
+  for (Ssize j = 0; j < n2; ++j) {
+    score += edit_step_(&e, edit_symbol_(s2, &pos, utf8), 1);
+
+    // each remaining column lower the score by one at most
+    if (score - (n2 - 1 - j) > max) {
+      score = -1;
+      break;
+    }
+  }
+  edit_free_(&e);
+
+  return score;
+}
+
+Ssize StrView_edit_distance(StrView s1, StrView s2) {
+  return edit_distance_(s1, s2, false, PTRDIFF_MAX);
+}
+
+Ssize StrView_edit_distance_max(StrView s1, StrView s2, Ssize max) {
+  return edit_distance_(s1, s2, false, max);
+}
+
+Ssize UTF8View_edit_distance(UTF8View s1, UTF8View s2) {
+  return edit_distance_(StrView_cast(s1), StrView_cast(s2), true, PTRDIFF_MAX);
+}
+
+Ssize UTF8View_edit_distance_max(UTF8View s1, UTF8View s2, Ssize max) {
+  return edit_distance_(StrView_cast(s1), StrView_cast(s2), true, max);
+}
+
+Ssize StrView_find_approx(StrView s, StrView match, Ssize max_errors, Ssize *size) {
+  struct EditPattern_ e;
+  Ssize pos = -1;
+  Ssize end = -1;
+  Ssize score = match.size;
+
+  if (size != NULL) *size = 0;
+  if (match.size <= max_errors) return 0;
+  if (!edit_init_(&e, match, match.size, false, false)) return -1;
+
+  // search: a match may start anywhere, the first end wins
+  for (Ssize j = 0; j < s.size; ++j) {
+    score += edit_step_(&e, s.data[j], 0);
+    if (score <= max_errors) {
+      end = j + 1;
+      break;
+    }
+  }
+  edit_free_(&e);
+  if (end < 0) return -1;
+
+  // reversed global alignment from end, first start reaching the score
+  const Ssize errors = score;
+  if (!edit_init_(&e, match, match.size, false, true)) return -1;
+  score = match.size;
+  for (Ssize i = end - 1; i >= 0; --i) {
+    score += edit_step_(&e, s.data[i], 1);
+    if (score <= errors) {
+      pos = i;
+      break;
+    }
+  }
+  edit_free_(&e);
+
+  if (size != NULL && pos >= 0) *size = end - pos;
+
+  return pos;
+}
+
+//----------------------------------------------------------------------------
+// normalization
+//----------------------------------------------------------------------------
+
+// tables generated from Unicode 14.0.0 data (python unicodedata).
+// properties: ccc | NFC_QC (0 yes, 1 no, 2 maybe) << 8 | NFD_QC no << 10,
+// two level lookup of 32 codepoints blocks up to U+30000.
+static const uint16_t norm_values_[67] = {
+  0x000, 0x001, 0x006, 0x007, 0x009, 0x00A, 0x00B, 0x00C, 0x00D, 0x00E, 0x00F, 0x010,
+  0x011, 0x012, 0x013, 0x014, 0x015, 0x016, 0x017, 0x018, 0x019, 0x01A, 0x01B, 0x01C,
+  0x01D, 0x01E, 0x01F, 0x020, 0x021, 0x022, 0x023, 0x024, 0x054, 0x067, 0x06B, 0x076,
+  0x07A, 0x081, 0x082, 0x084, 0x0CA, 0x0D6, 0x0D8, 0x0DA, 0x0DC, 0x0DE, 0x0E0, 0x0E2,
+  0x0E4, 0x0E6, 0x0E8, 0x0E9, 0x0EA, 0x200, 0x201, 0x207, 0x208, 0x209, 0x25B, 0x2CA,
+  0x2D8, 0x2DC, 0x2E6, 0x2F0, 0x400, 0x500, 0x5E6,
+};
+
+static const uint8_t norm_stage1_[6144] = {
+    0,   0,   0,   0,   0,   0,   1,   2,   3,   4,   5,   6,   0,   7,   8,   9,  10,  11,   0,   0,
+    0,   0,   0,   0,  12,  13,  14,  15,  16,  17,  18,   0,  19,  20,  21,  22,  23,   0,  24,  25,
+    0,   0,   0,   0,  26,  27,  28,   0,  29,  30,  31,  32,   0,   0,  33,  34,  35,  36,  37,   0,
+    0,   0,   0,  38,  39,  40,  41,   0,  42,   0,  43,  44,   0,  45,  46,   0,   0,  47,  48,  49,
+    0,  50,  51,   0,   0,  52,  53,   0,   0,  47,  54,   0,  55,  56,  57,   0,   0,  52,  58,   0,
+    0,  52,  59,   0,   0,  60,  57,   0,   0,   0,  61,   0,   0,  62,  63,   0,   0,  64,  65,   0,
+   66,  67,  68,  69,  70,  71,  72,   0,   0,  73,   0,   0,  74,   0,   0,   0,   0,   0,   0,  75,
+    0,  76,  77,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  78,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,  79,  80,   0,   0,   0,   0,  81,   0,   0,   0,   0,   0,   0,  82,   0,   0,
+    0,  83,   0,   0,   0,   0,   0,   0,  84,   0,   0,  85,   0,  86,  87,   0,  88,  89,  90,  91,
+    0,  92,   0,  93,   0,  94,   0,   0,   0,   0,  95,  96,   0,   0,   0,   0,   0,   0,  97,  98,
+   99,  99,  99,  99, 100,  99,  99, 101, 102,  99, 103, 104,  99, 105, 106, 107, 108,   0,   0,   0,
+    0,   0, 109, 110,   0, 111,   0,   0, 112, 113, 114,   0, 115, 116, 117, 118, 119, 120,   0, 121,
+    0, 122,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0, 123,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 124,
+    0,   0,   0, 125,   0,   0,   0, 126,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0, 127, 128, 129, 130, 128, 129, 131,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 132, 133,   0,   0, 134,   0,   0,   0,   0,
+    0,   0,   0,   0, 135, 136,   0,   0,   0,   0, 137, 138,   0, 139, 140,   0,   0, 141, 142,   0,
+    0,   0,   0,   0,   0, 143, 144, 145,   0,   0,   0,   0,   0,   0,   0,  53,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99, 146,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 147, 147, 147, 147, 147, 147, 147, 147,
+  148, 149, 147, 150, 147, 147, 151,   0, 152, 153, 154,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 155,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0, 156,   0,   0,   0,   0,   0,   0,   0, 157,   0,   0,   0, 158,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0, 159, 160,   0,   0,   0,   0,   0, 161,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 162,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0, 163,   0,   0,   0,   0, 164,   0, 165,   0,   0,   0,   0,   0, 135, 166,
+  167, 168,   0,   0, 169, 170,   0, 141,   0,   0, 171,   0,   0, 172,   0,   0,   0,   0,   0, 173,
+    0, 174, 175, 176,   0,   0,   0,   0,   0,   0, 177,   0,   0, 178, 179,   0,   0,   0,   0,   0,
+    0, 180, 181,   0,   0, 125,   0,   0,   0, 182,   0,   0,   0, 183,   0,   0,   0,   0,   0,   0,
+    0, 184,   0,   0,   0,   0,   0,   0,   0, 185, 186,   0,   0,   0,   0, 142,   0,  80, 187,   0,
+  188,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 125,   0,   0,   0,   0,   0,   0,
+    0,   0, 189,   0, 190,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0, 191,   0, 192,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0, 193,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 194,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0, 195, 196, 197, 198, 199,   0,   0,   0, 200,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  201, 202,   0,   0,   0,   0,   0,   0,   0, 192,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0, 203,   0, 204,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 205,   0,   0,   0, 206,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 147, 207,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,
+};
+
+static const uint8_t norm_stage2_[6656] = {
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 64, 64, 64, 64, 64, 64,  0, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+   0, 64, 64, 64, 64, 64, 64,  0,  0, 64, 64, 64, 64, 64,  0,  0, 64, 64, 64, 64, 64, 64,  0, 64,
+  64, 64, 64, 64, 64, 64, 64, 64,  0, 64, 64, 64, 64, 64, 64,  0,  0, 64, 64, 64, 64, 64,  0, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,  0,  0, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,  0,  0, 64, 64, 64, 64, 64, 64, 64, 64,
+  64,  0,  0,  0, 64, 64, 64, 64,  0, 64, 64, 64, 64, 64, 64,  0,  0,  0,  0, 64, 64, 64, 64, 64,
+  64,  0,  0,  0, 64, 64, 64, 64, 64, 64,  0,  0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64,  0,  0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64,  0, 64, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,
+  64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,  0, 64, 64,
+  64, 64, 64, 64,  0,  0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,  0,  0,  0, 64, 64,  0,  0,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,  0,  0, 64, 64,  0,  0,  0,  0,  0,  0, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  62, 62, 62, 62, 62, 49, 62, 62, 62, 62, 62, 62, 62, 49, 49, 62, 49, 62, 49, 62, 62, 50, 44, 44,
+  44, 44, 50, 60, 44, 44, 44, 44, 44, 40, 40, 61, 61, 61, 61, 59, 59, 44, 44, 44, 44, 61, 61, 44,
+  61, 61, 44, 44,  1,  1,  1,  1, 54, 44, 44, 44, 44, 49, 49, 49, 66, 66, 62, 66, 66, 63, 49, 44,
+  44, 44, 49, 49, 49, 44, 44,  0, 49, 49, 49, 44, 44, 44, 44, 49, 50, 44, 44, 49, 51, 52, 52, 51,
+  52, 52, 51, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,  0,  0,  0,  0, 65,  0,  0,  0,
+   0,  0,  0,  0,  0,  0, 65,  0,  0,  0,  0,  0,  0, 64, 64, 65, 64, 64, 64,  0, 64,  0, 64, 64,
+  64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0, 64, 64, 64, 64, 64, 64, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64, 64, 64, 64, 64,  0,  0,  0,  0, 64, 64,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 64, 64,  0, 64,  0,  0,  0, 64,  0,  0,  0,  0, 64, 64, 64,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64, 64,  0, 64,  0,  0,  0, 64,
+   0,  0,  0,  0, 64, 64, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0, 64, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 49, 49, 49, 49,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0, 64, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64, 64, 64, 64,  0,  0, 64, 64,
+   0,  0, 64, 64, 64, 64, 64, 64,  0,  0, 64, 64, 64, 64, 64, 64,  0,  0, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64,  0,  0, 64, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0, 44, 49, 49, 49, 49, 44, 49, 49, 49, 45, 44, 49, 49, 49, 49,
+  49, 49, 44, 44, 44, 44, 44, 44, 49, 49, 44, 49, 49, 45, 48, 49,  5,  6,  7,  8,  9, 10, 11, 12,
+  13, 14, 14, 15, 16, 17,  0, 18,  0, 19, 20,  0, 49, 44,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 49, 49, 49, 49, 49, 49, 49, 49, 25, 26, 27,  0,  0,  0,  0,  0,
+   0,  0, 64, 64, 64, 64, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 22, 23, 24, 25, 26,
+  27, 28, 29, 62, 62, 61, 44, 49, 49, 49, 49, 49, 44, 49, 49, 44,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 30,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  64,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0, 49, 49,
+  49, 49, 49, 49, 49,  0,  0, 49, 49, 49, 49, 44, 49,  0,  0, 49, 49,  0, 44, 49, 49, 44,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 44, 49, 49, 44, 49, 49, 44,
+  44, 44, 49, 44, 44, 49, 44, 49, 49, 49, 44, 49, 44, 49, 44, 49, 44, 49, 49,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0, 49, 49, 49, 49, 49, 49, 49, 44, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 49,
+  49, 49,  0, 49, 49, 49, 49, 49, 49, 49, 49, 49,  0, 49, 49, 49,  0, 49, 49, 49, 49, 49,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44, 44, 44,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  49, 44, 44, 44, 49, 49, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 49, 49, 49, 49, 44,
+  44, 44, 44, 44, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,  0, 44, 49, 49, 44, 49,
+  49, 44, 49, 49, 49, 44, 44, 44, 22, 23, 24, 49, 49, 49, 44, 49, 49, 44, 44, 49, 49, 49, 49, 49,
+   0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0, 64,  0,  0,  0,
+   0,  0,  0,  0, 55,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,
+   0, 49, 44, 49, 49,  0,  0,  0, 65, 65, 65, 65, 65, 65, 65, 65,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0, 53,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64, 64,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,
+   0,  0,  0,  0, 65, 65,  0, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 65,  0,  0, 65,  0,  0,  0,  0,  0,  3,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0, 65, 65, 65,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0, 64, 64,  4,  0,  0,  0,  0,  0,  0,  0,  0, 53, 53,
+   0,  0,  0,  0, 65, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64, 64, 64,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  0,  4,  0,  0,
+   0,  0,  0,  0,  0, 32, 58,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0, 53,  0,  0,  0,  0, 64,
+  64,  0, 64, 64,  0,  4,  0,  0,  0,  0,  0,  0,  0, 53, 53,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  4,  4,  0, 53,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 57,  0,  0,  0,  0, 53,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0, 64, 64, 64, 53,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 33, 33,  4,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 34, 34, 34, 34,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 35, 35,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  36, 36, 36, 36,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  44, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0, 44,  0, 44,  0, 42,  0,  0,  0,  0,  0,  0,  0,  0,  0, 65,  0,  0,  0,  0,
+   0,  0,  0,  0,  0, 65,  0,  0,  0,  0, 65,  0,  0,  0,  0, 65,  0,  0,  0,  0, 65,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0, 37, 38, 65, 39, 65, 65,  0,
+  65,  0, 38, 38, 38, 38,  0,  0, 38, 65, 49, 49,  4,  0, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0, 65,  0,  0,  0,  0, 65,  0,  0,  0,  0, 65,
+   0,  0,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 65,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0, 53,  0,
+   0,  0,  0,  0,  0,  0,  0,  3,  0,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53, 53, 53, 53, 53, 53, 53, 53,
+  53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0, 49, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 45, 49, 44,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,
+  44,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0, 49, 49, 49, 49, 49, 49, 49, 49,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 49, 49, 49, 49, 49, 44, 44, 44, 44, 44, 44, 49, 49, 44,  0, 44,
+  44, 49, 49, 44, 44, 49, 49, 49, 49, 49, 44, 49, 49, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0, 64,  0, 64,  0, 64,  0, 64,  0,
+   0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3, 53,  0,  0,  0,  0,  0, 64,  0, 64,  0,  0,
+  64, 64,  0, 64,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 44, 49, 49, 49,
+  49, 49, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  4,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 49, 49, 49,  0,  1, 44, 44, 44, 44, 44, 49, 49, 44, 44, 44, 44,
+  49,  0,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0, 44,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,
+  49, 49,  0,  0,  0,  0,  0,  0, 49, 49, 44, 49, 49, 49, 49, 49, 49, 49, 44, 49, 49, 52, 41, 44,
+  40, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 50, 48, 48, 44, 43, 49, 51, 44, 49, 44,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64,  0, 64,  0,  0,  0,  0, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,  0,  0,  0,  0,  0,  0,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,  0,  0,
+  64, 64, 64, 64, 64, 64,  0,  0, 64, 64, 64, 64, 64, 64,  0,  0, 64, 64, 64, 64, 64, 64,  0,  0,
+  64, 64, 64, 64, 64, 64, 64, 64,  0, 64,  0, 64,  0, 64,  0, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65, 64, 65,  0,  0,
+  64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,  0, 64, 64,
+  64, 64, 64, 65, 64,  0, 65,  0,  0, 64, 64, 64, 64,  0, 64, 64, 64, 65, 64, 65, 64, 64, 64, 64,
+  64, 64, 64, 65,  0,  0, 64, 64, 64, 64, 64, 65,  0, 64, 64, 64, 64, 64, 64, 65, 64, 64, 64, 64,
+  64, 64, 64, 65, 64, 64, 65, 65,  0,  0, 64, 64, 64,  0, 64, 64, 64, 65, 64, 65, 64, 65,  0,  0,
+  65, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  49, 49,  1,  1, 49, 49, 49, 49,  1,  1,  1, 49, 49,  0,  0,  0,  0, 49,  0,  0,  0,  1,  1, 49,
+  44, 49,  1,  1, 44, 44, 44, 44, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0, 65,  0,  0,  0, 65, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64, 64, 64,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  0, 64,  0,  0, 64,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0, 64,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0, 64,  0,  0, 64,  0,  0, 64,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 64,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64, 64, 64,
+  64, 64,  0,  0, 64, 64,  0,  0, 64, 64,  0,  0,  0,  0,  0,  0, 64, 64,  0,  0, 64, 64,  0,  0,
+  64, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64, 64, 64, 64,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 64, 64, 64, 64,  0,  0,  0,  0,  0,  0, 64, 64, 64, 64,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0, 65, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,
+  49, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 43, 48, 50, 45, 46, 46,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0, 64,  0, 64,  0, 64,  0, 64,  0, 64,  0, 64,  0, 64,  0, 64,  0, 64,  0, 64,  0,
+  64,  0, 64,  0,  0, 64,  0, 64,  0, 64,  0,  0,  0,  0,  0,  0, 64, 64,  0, 64, 64,  0, 64, 64,
+   0, 64, 64,  0, 64, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0, 64,  0,  0,  0,  0, 56, 56,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0, 64, 64, 64, 64,  0,  0,  0, 64,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  0, 49, 49, 49, 49,
+  49, 49, 49, 49, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44, 44, 44,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 49,  0, 49, 49, 44,  0,  0, 49, 49,  0,  0,  0,  0,  0, 49, 49,
+   0, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64, 64, 64, 64,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+  65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,  0,  0,
+  65,  0, 65,  0,  0, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,  0, 65,  0, 65,  0,  0, 65, 65,  0,
+   0,  0, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+  65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,  0,  0, 65, 65, 65, 65, 65, 65, 65, 65,
+  65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+  65, 65, 65, 65, 65, 65, 65, 65, 65, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 65, 21, 65,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,  0,
+  65, 65, 65, 65, 65,  0, 65,  0, 65, 65,  0, 65, 65,  0, 65, 65, 65, 65, 65, 65, 65, 65, 65,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 49, 49, 49, 49, 49, 49, 44,
+  44, 44, 44, 44, 44, 44, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0, 44,  0,  0, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 49, 49, 49, 49,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44,  0, 49,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 49,  1, 44,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0, 49, 44,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0, 49, 49, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 49,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 44, 44,
+  49, 49, 49, 44, 49, 44, 44, 44, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0, 49, 44, 49, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0, 64,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  4, 55,  0,  0,  0,  0,  0, 49, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,
+   0,  0,  0,  0,  0,  0, 64, 64,  0,  0,  0,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  4,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  3,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  3,  3,  0, 53,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64, 64,  4,  0,  0,
+   0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 49,
+  49, 49, 49, 49, 49,  0,  0,  0, 49, 49, 49, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  4,  0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  53,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53, 64, 64, 53, 64,  0,  0,  0,  4,  3,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0, 64, 64,  0,  0,  0,  4,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  3,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 53,  0,  0,  0,  0,  0,  0,  0, 64,  0,  0,  0,  0,  4,  4,  0,
+   0,  0,  0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,
+   0,  0,  3,  0,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 49, 49, 49, 49, 49, 49,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0, 65, 65, 65, 65, 65, 65, 65, 42, 42,  1,  1,  1,  0,  0,  0, 47, 42, 42,
+  42, 42, 42,  0,  0,  0,  0,  0,  0,  0,  0, 44, 44, 44, 44, 44, 44, 44, 44,  0,  0, 49, 49, 49,
+  49, 49, 44, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 49, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0, 65, 65, 65, 65, 65, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 49, 49,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  49, 49, 49, 49, 49, 49, 49,  0, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+  49,  0,  0, 49, 49, 49, 49, 49, 49, 49,  0, 49, 49,  0, 49, 49, 49, 49, 49,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0, 49,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 49, 49, 49,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  44, 44, 44, 44, 44, 44, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 49, 49, 49, 49,
+  49, 49,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+  65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+  65, 65, 65, 65, 65, 65,  0,  0,
+};
+
+// canonical decompositions, one or two codepoints, sorted by codepoint.
+static const int32_t norm_decompositions_[2061][3] = {
+  {0x000C0, 0x00041, 0x00300}, {0x000C1, 0x00041, 0x00301}, {0x000C2, 0x00041, 0x00302}, {0x000C3, 0x00041, 0x00303},
+  {0x000C4, 0x00041, 0x00308}, {0x000C5, 0x00041, 0x0030A}, {0x000C7, 0x00043, 0x00327}, {0x000C8, 0x00045, 0x00300},
+  {0x000C9, 0x00045, 0x00301}, {0x000CA, 0x00045, 0x00302}, {0x000CB, 0x00045, 0x00308}, {0x000CC, 0x00049, 0x00300},
+  {0x000CD, 0x00049, 0x00301}, {0x000CE, 0x00049, 0x00302}, {0x000CF, 0x00049, 0x00308}, {0x000D1, 0x0004E, 0x00303},
+  {0x000D2, 0x0004F, 0x00300}, {0x000D3, 0x0004F, 0x00301}, {0x000D4, 0x0004F, 0x00302}, {0x000D5, 0x0004F, 0x00303},
+  {0x000D6, 0x0004F, 0x00308}, {0x000D9, 0x00055, 0x00300}, {0x000DA, 0x00055, 0x00301}, {0x000DB, 0x00055, 0x00302},
+  {0x000DC, 0x00055, 0x00308}, {0x000DD, 0x00059, 0x00301}, {0x000E0, 0x00061, 0x00300}, {0x000E1, 0x00061, 0x00301},
+  {0x000E2, 0x00061, 0x00302}, {0x000E3, 0x00061, 0x00303}, {0x000E4, 0x00061, 0x00308}, {0x000E5, 0x00061, 0x0030A},
+  {0x000E7, 0x00063, 0x00327}, {0x000E8, 0x00065, 0x00300}, {0x000E9, 0x00065, 0x00301}, {0x000EA, 0x00065, 0x00302},
+  {0x000EB, 0x00065, 0x00308}, {0x000EC, 0x00069, 0x00300}, {0x000ED, 0x00069, 0x00301}, {0x000EE, 0x00069, 0x00302},
+  {0x000EF, 0x00069, 0x00308}, {0x000F1, 0x0006E, 0x00303}, {0x000F2, 0x0006F, 0x00300}, {0x000F3, 0x0006F, 0x00301},
+  {0x000F4, 0x0006F, 0x00302}, {0x000F5, 0x0006F, 0x00303}, {0x000F6, 0x0006F, 0x00308}, {0x000F9, 0x00075, 0x00300},
+  {0x000FA, 0x00075, 0x00301}, {0x000FB, 0x00075, 0x00302}, {0x000FC, 0x00075, 0x00308}, {0x000FD, 0x00079, 0x00301},
+  {0x000FF, 0x00079, 0x00308}, {0x00100, 0x00041, 0x00304}, {0x00101, 0x00061, 0x00304}, {0x00102, 0x00041, 0x00306},
+  {0x00103, 0x00061, 0x00306}, {0x00104, 0x00041, 0x00328}, {0x00105, 0x00061, 0x00328}, {0x00106, 0x00043, 0x00301},
+  {0x00107, 0x00063, 0x00301}, {0x00108, 0x00043, 0x00302}, {0x00109, 0x00063, 0x00302}, {0x0010A, 0x00043, 0x00307},
+  {0x0010B, 0x00063, 0x00307}, {0x0010C, 0x00043, 0x0030C}, {0x0010D, 0x00063, 0x0030C}, {0x0010E, 0x00044, 0x0030C},
+  {0x0010F, 0x00064, 0x0030C}, {0x00112, 0x00045, 0x00304}, {0x00113, 0x00065, 0x00304}, {0x00114, 0x00045, 0x00306},
+  {0x00115, 0x00065, 0x00306}, {0x00116, 0x00045, 0x00307}, {0x00117, 0x00065, 0x00307}, {0x00118, 0x00045, 0x00328},
+  {0x00119, 0x00065, 0x00328}, {0x0011A, 0x00045, 0x0030C}, {0x0011B, 0x00065, 0x0030C}, {0x0011C, 0x00047, 0x00302},
+  {0x0011D, 0x00067, 0x00302}, {0x0011E, 0x00047, 0x00306}, {0x0011F, 0x00067, 0x00306}, {0x00120, 0x00047, 0x00307},
+  {0x00121, 0x00067, 0x00307}, {0x00122, 0x00047, 0x00327}, {0x00123, 0x00067, 0x00327}, {0x00124, 0x00048, 0x00302},
+  {0x00125, 0x00068, 0x00302}, {0x00128, 0x00049, 0x00303}, {0x00129, 0x00069, 0x00303}, {0x0012A, 0x00049, 0x00304},
+  {0x0012B, 0x00069, 0x00304}, {0x0012C, 0x00049, 0x00306}, {0x0012D, 0x00069, 0x00306}, {0x0012E, 0x00049, 0x00328},
+  {0x0012F, 0x00069, 0x00328}, {0x00130, 0x00049, 0x00307}, {0x00134, 0x0004A, 0x00302}, {0x00135, 0x0006A, 0x00302},
+  {0x00136, 0x0004B, 0x00327}, {0x00137, 0x0006B, 0x00327}, {0x00139, 0x0004C, 0x00301}, {0x0013A, 0x0006C, 0x00301},
+  {0x0013B, 0x0004C, 0x00327}, {0x0013C, 0x0006C, 0x00327}, {0x0013D, 0x0004C, 0x0030C}, {0x0013E, 0x0006C, 0x0030C},
+  {0x00143, 0x0004E, 0x00301}, {0x00144, 0x0006E, 0x00301}, {0x00145, 0x0004E, 0x00327}, {0x00146, 0x0006E, 0x00327},
+  {0x00147, 0x0004E, 0x0030C}, {0x00148, 0x0006E, 0x0030C}, {0x0014C, 0x0004F, 0x00304}, {0x0014D, 0x0006F, 0x00304},
+  {0x0014E, 0x0004F, 0x00306}, {0x0014F, 0x0006F, 0x00306}, {0x00150, 0x0004F, 0x0030B}, {0x00151, 0x0006F, 0x0030B},
+  {0x00154, 0x00052, 0x00301}, {0x00155, 0x00072, 0x00301}, {0x00156, 0x00052, 0x00327}, {0x00157, 0x00072, 0x00327},
+  {0x00158, 0x00052, 0x0030C}, {0x00159, 0x00072, 0x0030C}, {0x0015A, 0x00053, 0x00301}, {0x0015B, 0x00073, 0x00301},
+  {0x0015C, 0x00053, 0x00302}, {0x0015D, 0x00073, 0x00302}, {0x0015E, 0x00053, 0x00327}, {0x0015F, 0x00073, 0x00327},
+  {0x00160, 0x00053, 0x0030C}, {0x00161, 0x00073, 0x0030C}, {0x00162, 0x00054, 0x00327}, {0x00163, 0x00074, 0x00327},
+  {0x00164, 0x00054, 0x0030C}, {0x00165, 0x00074, 0x0030C}, {0x00168, 0x00055, 0x00303}, {0x00169, 0x00075, 0x00303},
+  {0x0016A, 0x00055, 0x00304}, {0x0016B, 0x00075, 0x00304}, {0x0016C, 0x00055, 0x00306}, {0x0016D, 0x00075, 0x00306},
+  {0x0016E, 0x00055, 0x0030A}, {0x0016F, 0x00075, 0x0030A}, {0x00170, 0x00055, 0x0030B}, {0x00171, 0x00075, 0x0030B},
+  {0x00172, 0x00055, 0x00328}, {0x00173, 0x00075, 0x00328}, {0x00174, 0x00057, 0x00302}, {0x00175, 0x00077, 0x00302},
+  {0x00176, 0x00059, 0x00302}, {0x00177, 0x00079, 0x00302}, {0x00178, 0x00059, 0x00308}, {0x00179, 0x0005A, 0x00301},
+  {0x0017A, 0x0007A, 0x00301}, {0x0017B, 0x0005A, 0x00307}, {0x0017C, 0x0007A, 0x00307}, {0x0017D, 0x0005A, 0x0030C},
+  {0x0017E, 0x0007A, 0x0030C}, {0x001A0, 0x0004F, 0x0031B}, {0x001A1, 0x0006F, 0x0031B}, {0x001AF, 0x00055, 0x0031B},
+  {0x001B0, 0x00075, 0x0031B}, {0x001CD, 0x00041, 0x0030C}, {0x001CE, 0x00061, 0x0030C}, {0x001CF, 0x00049, 0x0030C},
+  {0x001D0, 0x00069, 0x0030C}, {0x001D1, 0x0004F, 0x0030C}, {0x001D2, 0x0006F, 0x0030C}, {0x001D3, 0x00055, 0x0030C},
+  {0x001D4, 0x00075, 0x0030C}, {0x001D5, 0x000DC, 0x00304}, {0x001D6, 0x000FC, 0x00304}, {0x001D7, 0x000DC, 0x00301},
+  {0x001D8, 0x000FC, 0x00301}, {0x001D9, 0x000DC, 0x0030C}, {0x001DA, 0x000FC, 0x0030C}, {0x001DB, 0x000DC, 0x00300},
+  {0x001DC, 0x000FC, 0x00300}, {0x001DE, 0x000C4, 0x00304}, {0x001DF, 0x000E4, 0x00304}, {0x001E0, 0x00226, 0x00304},
+  {0x001E1, 0x00227, 0x00304}, {0x001E2, 0x000C6, 0x00304}, {0x001E3, 0x000E6, 0x00304}, {0x001E6, 0x00047, 0x0030C},
+  {0x001E7, 0x00067, 0x0030C}, {0x001E8, 0x0004B, 0x0030C}, {0x001E9, 0x0006B, 0x0030C}, {0x001EA, 0x0004F, 0x00328},
+  {0x001EB, 0x0006F, 0x00328}, {0x001EC, 0x001EA, 0x00304}, {0x001ED, 0x001EB, 0x00304}, {0x001EE, 0x001B7, 0x0030C},
+  {0x001EF, 0x00292, 0x0030C}, {0x001F0, 0x0006A, 0x0030C}, {0x001F4, 0x00047, 0x00301}, {0x001F5, 0x00067, 0x00301},
+  {0x001F8, 0x0004E, 0x00300}, {0x001F9, 0x0006E, 0x00300}, {0x001FA, 0x000C5, 0x00301}, {0x001FB, 0x000E5, 0x00301},
+  {0x001FC, 0x000C6, 0x00301}, {0x001FD, 0x000E6, 0x00301}, {0x001FE, 0x000D8, 0x00301}, {0x001FF, 0x000F8, 0x00301},
+  {0x00200, 0x00041, 0x0030F}, {0x00201, 0x00061, 0x0030F}, {0x00202, 0x00041, 0x00311}, {0x00203, 0x00061, 0x00311},
+  {0x00204, 0x00045, 0x0030F}, {0x00205, 0x00065, 0x0030F}, {0x00206, 0x00045, 0x00311}, {0x00207, 0x00065, 0x00311},
+  {0x00208, 0x00049, 0x0030F}, {0x00209, 0x00069, 0x0030F}, {0x0020A, 0x00049, 0x00311}, {0x0020B, 0x00069, 0x00311},
+  {0x0020C, 0x0004F, 0x0030F}, {0x0020D, 0x0006F, 0x0030F}, {0x0020E, 0x0004F, 0x00311}, {0x0020F, 0x0006F, 0x00311},
+  {0x00210, 0x00052, 0x0030F}, {0x00211, 0x00072, 0x0030F}, {0x00212, 0x00052, 0x00311}, {0x00213, 0x00072, 0x00311},
+  {0x00214, 0x00055, 0x0030F}, {0x00215, 0x00075, 0x0030F}, {0x00216, 0x00055, 0x00311}, {0x00217, 0x00075, 0x00311},
+  {0x00218, 0x00053, 0x00326}, {0x00219, 0x00073, 0x00326}, {0x0021A, 0x00054, 0x00326}, {0x0021B, 0x00074, 0x00326},
+  {0x0021E, 0x00048, 0x0030C}, {0x0021F, 0x00068, 0x0030C}, {0x00226, 0x00041, 0x00307}, {0x00227, 0x00061, 0x00307},
+  {0x00228, 0x00045, 0x00327}, {0x00229, 0x00065, 0x00327}, {0x0022A, 0x000D6, 0x00304}, {0x0022B, 0x000F6, 0x00304},
+  {0x0022C, 0x000D5, 0x00304}, {0x0022D, 0x000F5, 0x00304}, {0x0022E, 0x0004F, 0x00307}, {0x0022F, 0x0006F, 0x00307},
+  {0x00230, 0x0022E, 0x00304}, {0x00231, 0x0022F, 0x00304}, {0x00232, 0x00059, 0x00304}, {0x00233, 0x00079, 0x00304},
+  {0x00340, 0x00300, 0x00000}, {0x00341, 0x00301, 0x00000}, {0x00343, 0x00313, 0x00000}, {0x00344, 0x00308, 0x00301},
+  {0x00374, 0x002B9, 0x00000}, {0x0037E, 0x0003B, 0x00000}, {0x00385, 0x000A8, 0x00301}, {0x00386, 0x00391, 0x00301},
+  {0x00387, 0x000B7, 0x00000}, {0x00388, 0x00395, 0x00301}, {0x00389, 0x00397, 0x00301}, {0x0038A, 0x00399, 0x00301},
+  {0x0038C, 0x0039F, 0x00301}, {0x0038E, 0x003A5, 0x00301}, {0x0038F, 0x003A9, 0x00301}, {0x00390, 0x003CA, 0x00301},
+  {0x003AA, 0x00399, 0x00308}, {0x003AB, 0x003A5, 0x00308}, {0x003AC, 0x003B1, 0x00301}, {0x003AD, 0x003B5, 0x00301},
+  {0x003AE, 0x003B7, 0x00301}, {0x003AF, 0x003B9, 0x00301}, {0x003B0, 0x003CB, 0x00301}, {0x003CA, 0x003B9, 0x00308},
+  {0x003CB, 0x003C5, 0x00308}, {0x003CC, 0x003BF, 0x00301}, {0x003CD, 0x003C5, 0x00301}, {0x003CE, 0x003C9, 0x00301},
+  {0x003D3, 0x003D2, 0x00301}, {0x003D4, 0x003D2, 0x00308}, {0x00400, 0x00415, 0x00300}, {0x00401, 0x00415, 0x00308},
+  {0x00403, 0x00413, 0x00301}, {0x00407, 0x00406, 0x00308}, {0x0040C, 0x0041A, 0x00301}, {0x0040D, 0x00418, 0x00300},
+  {0x0040E, 0x00423, 0x00306}, {0x00419, 0x00418, 0x00306}, {0x00439, 0x00438, 0x00306}, {0x00450, 0x00435, 0x00300},
+  {0x00451, 0x00435, 0x00308}, {0x00453, 0x00433, 0x00301}, {0x00457, 0x00456, 0x00308}, {0x0045C, 0x0043A, 0x00301},
+  {0x0045D, 0x00438, 0x00300}, {0x0045E, 0x00443, 0x00306}, {0x00476, 0x00474, 0x0030F}, {0x00477, 0x00475, 0x0030F},
+  {0x004C1, 0x00416, 0x00306}, {0x004C2, 0x00436, 0x00306}, {0x004D0, 0x00410, 0x00306}, {0x004D1, 0x00430, 0x00306},
+  {0x004D2, 0x00410, 0x00308}, {0x004D3, 0x00430, 0x00308}, {0x004D6, 0x00415, 0x00306}, {0x004D7, 0x00435, 0x00306},
+  {0x004DA, 0x004D8, 0x00308}, {0x004DB, 0x004D9, 0x00308}, {0x004DC, 0x00416, 0x00308}, {0x004DD, 0x00436, 0x00308},
+  {0x004DE, 0x00417, 0x00308}, {0x004DF, 0x00437, 0x00308}, {0x004E2, 0x00418, 0x00304}, {0x004E3, 0x00438, 0x00304},
+  {0x004E4, 0x00418, 0x00308}, {0x004E5, 0x00438, 0x00308}, {0x004E6, 0x0041E, 0x00308}, {0x004E7, 0x0043E, 0x00308},
+  {0x004EA, 0x004E8, 0x00308}, {0x004EB, 0x004E9, 0x00308}, {0x004EC, 0x0042D, 0x00308}, {0x004ED, 0x0044D, 0x00308},
+  {0x004EE, 0x00423, 0x00304}, {0x004EF, 0x00443, 0x00304}, {0x004F0, 0x00423, 0x00308}, {0x004F1, 0x00443, 0x00308},
+  {0x004F2, 0x00423, 0x0030B}, {0x004F3, 0x00443, 0x0030B}, {0x004F4, 0x00427, 0x00308}, {0x004F5, 0x00447, 0x00308},
+  {0x004F8, 0x0042B, 0x00308}, {0x004F9, 0x0044B, 0x00308}, {0x00622, 0x00627, 0x00653}, {0x00623, 0x00627, 0x00654},
+  {0x00624, 0x00648, 0x00654}, {0x00625, 0x00627, 0x00655}, {0x00626, 0x0064A, 0x00654}, {0x006C0, 0x006D5, 0x00654},
+  {0x006C2, 0x006C1, 0x00654}, {0x006D3, 0x006D2, 0x00654}, {0x00929, 0x00928, 0x0093C}, {0x00931, 0x00930, 0x0093C},
+  {0x00934, 0x00933, 0x0093C}, {0x00958, 0x00915, 0x0093C}, {0x00959, 0x00916, 0x0093C}, {0x0095A, 0x00917, 0x0093C},
+  {0x0095B, 0x0091C, 0x0093C}, {0x0095C, 0x00921, 0x0093C}, {0x0095D, 0x00922, 0x0093C}, {0x0095E, 0x0092B, 0x0093C},
+  {0x0095F, 0x0092F, 0x0093C}, {0x009CB, 0x009C7, 0x009BE}, {0x009CC, 0x009C7, 0x009D7}, {0x009DC, 0x009A1, 0x009BC},
+  {0x009DD, 0x009A2, 0x009BC}, {0x009DF, 0x009AF, 0x009BC}, {0x00A33, 0x00A32, 0x00A3C}, {0x00A36, 0x00A38, 0x00A3C},
+  {0x00A59, 0x00A16, 0x00A3C}, {0x00A5A, 0x00A17, 0x00A3C}, {0x00A5B, 0x00A1C, 0x00A3C}, {0x00A5E, 0x00A2B, 0x00A3C},
+  {0x00B48, 0x00B47, 0x00B56}, {0x00B4B, 0x00B47, 0x00B3E}, {0x00B4C, 0x00B47, 0x00B57}, {0x00B5C, 0x00B21, 0x00B3C},
+  {0x00B5D, 0x00B22, 0x00B3C}, {0x00B94, 0x00B92, 0x00BD7}, {0x00BCA, 0x00BC6, 0x00BBE}, {0x00BCB, 0x00BC7, 0x00BBE},
+  {0x00BCC, 0x00BC6, 0x00BD7}, {0x00C48, 0x00C46, 0x00C56}, {0x00CC0, 0x00CBF, 0x00CD5}, {0x00CC7, 0x00CC6, 0x00CD5},
+  {0x00CC8, 0x00CC6, 0x00CD6}, {0x00CCA, 0x00CC6, 0x00CC2}, {0x00CCB, 0x00CCA, 0x00CD5}, {0x00D4A, 0x00D46, 0x00D3E},
+  {0x00D4B, 0x00D47, 0x00D3E}, {0x00D4C, 0x00D46, 0x00D57}, {0x00DDA, 0x00DD9, 0x00DCA}, {0x00DDC, 0x00DD9, 0x00DCF},
+  {0x00DDD, 0x00DDC, 0x00DCA}, {0x00DDE, 0x00DD9, 0x00DDF}, {0x00F43, 0x00F42, 0x00FB7}, {0x00F4D, 0x00F4C, 0x00FB7},
+  {0x00F52, 0x00F51, 0x00FB7}, {0x00F57, 0x00F56, 0x00FB7}, {0x00F5C, 0x00F5B, 0x00FB7}, {0x00F69, 0x00F40, 0x00FB5},
+  {0x00F73, 0x00F71, 0x00F72}, {0x00F75, 0x00F71, 0x00F74}, {0x00F76, 0x00FB2, 0x00F80}, {0x00F78, 0x00FB3, 0x00F80},
+  {0x00F81, 0x00F71, 0x00F80}, {0x00F93, 0x00F92, 0x00FB7}, {0x00F9D, 0x00F9C, 0x00FB7}, {0x00FA2, 0x00FA1, 0x00FB7},
+  {0x00FA7, 0x00FA6, 0x00FB7}, {0x00FAC, 0x00FAB, 0x00FB7}, {0x00FB9, 0x00F90, 0x00FB5}, {0x01026, 0x01025, 0x0102E},
+  {0x01B06, 0x01B05, 0x01B35}, {0x01B08, 0x01B07, 0x01B35}, {0x01B0A, 0x01B09, 0x01B35}, {0x01B0C, 0x01B0B, 0x01B35},
+  {0x01B0E, 0x01B0D, 0x01B35}, {0x01B12, 0x01B11, 0x01B35}, {0x01B3B, 0x01B3A, 0x01B35}, {0x01B3D, 0x01B3C, 0x01B35},
+  {0x01B40, 0x01B3E, 0x01B35}, {0x01B41, 0x01B3F, 0x01B35}, {0x01B43, 0x01B42, 0x01B35}, {0x01E00, 0x00041, 0x00325},
+  {0x01E01, 0x00061, 0x00325}, {0x01E02, 0x00042, 0x00307}, {0x01E03, 0x00062, 0x00307}, {0x01E04, 0x00042, 0x00323},
+  {0x01E05, 0x00062, 0x00323}, {0x01E06, 0x00042, 0x00331}, {0x01E07, 0x00062, 0x00331}, {0x01E08, 0x000C7, 0x00301},
+  {0x01E09, 0x000E7, 0x00301}, {0x01E0A, 0x00044, 0x00307}, {0x01E0B, 0x00064, 0x00307}, {0x01E0C, 0x00044, 0x00323},
+  {0x01E0D, 0x00064, 0x00323}, {0x01E0E, 0x00044, 0x00331}, {0x01E0F, 0x00064, 0x00331}, {0x01E10, 0x00044, 0x00327},
+  {0x01E11, 0x00064, 0x00327}, {0x01E12, 0x00044, 0x0032D}, {0x01E13, 0x00064, 0x0032D}, {0x01E14, 0x00112, 0x00300},
+  {0x01E15, 0x00113, 0x00300}, {0x01E16, 0x00112, 0x00301}, {0x01E17, 0x00113, 0x00301}, {0x01E18, 0x00045, 0x0032D},
+  {0x01E19, 0x00065, 0x0032D}, {0x01E1A, 0x00045, 0x00330}, {0x01E1B, 0x00065, 0x00330}, {0x01E1C, 0x00228, 0x00306},
+  {0x01E1D, 0x00229, 0x00306}, {0x01E1E, 0x00046, 0x00307}, {0x01E1F, 0x00066, 0x00307}, {0x01E20, 0x00047, 0x00304},
+  {0x01E21, 0x00067, 0x00304}, {0x01E22, 0x00048, 0x00307}, {0x01E23, 0x00068, 0x00307}, {0x01E24, 0x00048, 0x00323},
+  {0x01E25, 0x00068, 0x00323}, {0x01E26, 0x00048, 0x00308}, {0x01E27, 0x00068, 0x00308}, {0x01E28, 0x00048, 0x00327},
+  {0x01E29, 0x00068, 0x00327}, {0x01E2A, 0x00048, 0x0032E}, {0x01E2B, 0x00068, 0x0032E}, {0x01E2C, 0x00049, 0x00330},
+  {0x01E2D, 0x00069, 0x00330}, {0x01E2E, 0x000CF, 0x00301}, {0x01E2F, 0x000EF, 0x00301}, {0x01E30, 0x0004B, 0x00301},
+  {0x01E31, 0x0006B, 0x00301}, {0x01E32, 0x0004B, 0x00323}, {0x01E33, 0x0006B, 0x00323}, {0x01E34, 0x0004B, 0x00331},
+  {0x01E35, 0x0006B, 0x00331}, {0x01E36, 0x0004C, 0x00323}, {0x01E37, 0x0006C, 0x00323}, {0x01E38, 0x01E36, 0x00304},
+  {0x01E39, 0x01E37, 0x00304}, {0x01E3A, 0x0004C, 0x00331}, {0x01E3B, 0x0006C, 0x00331}, {0x01E3C, 0x0004C, 0x0032D},
+  {0x01E3D, 0x0006C, 0x0032D}, {0x01E3E, 0x0004D, 0x00301}, {0x01E3F, 0x0006D, 0x00301}, {0x01E40, 0x0004D, 0x00307},
+  {0x01E41, 0x0006D, 0x00307}, {0x01E42, 0x0004D, 0x00323}, {0x01E43, 0x0006D, 0x00323}, {0x01E44, 0x0004E, 0x00307},
+  {0x01E45, 0x0006E, 0x00307}, {0x01E46, 0x0004E, 0x00323}, {0x01E47, 0x0006E, 0x00323}, {0x01E48, 0x0004E, 0x00331},
+  {0x01E49, 0x0006E, 0x00331}, {0x01E4A, 0x0004E, 0x0032D}, {0x01E4B, 0x0006E, 0x0032D}, {0x01E4C, 0x000D5, 0x00301},
+  {0x01E4D, 0x000F5, 0x00301}, {0x01E4E, 0x000D5, 0x00308}, {0x01E4F, 0x000F5, 0x00308}, {0x01E50, 0x0014C, 0x00300},
+  {0x01E51, 0x0014D, 0x00300}, {0x01E52, 0x0014C, 0x00301}, {0x01E53, 0x0014D, 0x00301}, {0x01E54, 0x00050, 0x00301},
+  {0x01E55, 0x00070, 0x00301}, {0x01E56, 0x00050, 0x00307}, {0x01E57, 0x00070, 0x00307}, {0x01E58, 0x00052, 0x00307},
+  {0x01E59, 0x00072, 0x00307}, {0x01E5A, 0x00052, 0x00323}, {0x01E5B, 0x00072, 0x00323}, {0x01E5C, 0x01E5A, 0x00304},
+  {0x01E5D, 0x01E5B, 0x00304}, {0x01E5E, 0x00052, 0x00331}, {0x01E5F, 0x00072, 0x00331}, {0x01E60, 0x00053, 0x00307},
+  {0x01E61, 0x00073, 0x00307}, {0x01E62, 0x00053, 0x00323}, {0x01E63, 0x00073, 0x00323}, {0x01E64, 0x0015A, 0x00307},
+  {0x01E65, 0x0015B, 0x00307}, {0x01E66, 0x00160, 0x00307}, {0x01E67, 0x00161, 0x00307}, {0x01E68, 0x01E62, 0x00307},
+  {0x01E69, 0x01E63, 0x00307}, {0x01E6A, 0x00054, 0x00307}, {0x01E6B, 0x00074, 0x00307}, {0x01E6C, 0x00054, 0x00323},
+  {0x01E6D, 0x00074, 0x00323}, {0x01E6E, 0x00054, 0x00331}, {0x01E6F, 0x00074, 0x00331}, {0x01E70, 0x00054, 0x0032D},
+  {0x01E71, 0x00074, 0x0032D}, {0x01E72, 0x00055, 0x00324}, {0x01E73, 0x00075, 0x00324}, {0x01E74, 0x00055, 0x00330},
+  {0x01E75, 0x00075, 0x00330}, {0x01E76, 0x00055, 0x0032D}, {0x01E77, 0x00075, 0x0032D}, {0x01E78, 0x00168, 0x00301},
+  {0x01E79, 0x00169, 0x00301}, {0x01E7A, 0x0016A, 0x00308}, {0x01E7B, 0x0016B, 0x00308}, {0x01E7C, 0x00056, 0x00303},
+  {0x01E7D, 0x00076, 0x00303}, {0x01E7E, 0x00056, 0x00323}, {0x01E7F, 0x00076, 0x00323}, {0x01E80, 0x00057, 0x00300},
+  {0x01E81, 0x00077, 0x00300}, {0x01E82, 0x00057, 0x00301}, {0x01E83, 0x00077, 0x00301}, {0x01E84, 0x00057, 0x00308},
+  {0x01E85, 0x00077, 0x00308}, {0x01E86, 0x00057, 0x00307}, {0x01E87, 0x00077, 0x00307}, {0x01E88, 0x00057, 0x00323},
+  {0x01E89, 0x00077, 0x00323}, {0x01E8A, 0x00058, 0x00307}, {0x01E8B, 0x00078, 0x00307}, {0x01E8C, 0x00058, 0x00308},
+  {0x01E8D, 0x00078, 0x00308}, {0x01E8E, 0x00059, 0x00307}, {0x01E8F, 0x00079, 0x00307}, {0x01E90, 0x0005A, 0x00302},
+  {0x01E91, 0x0007A, 0x00302}, {0x01E92, 0x0005A, 0x00323}, {0x01E93, 0x0007A, 0x00323}, {0x01E94, 0x0005A, 0x00331},
+  {0x01E95, 0x0007A, 0x00331}, {0x01E96, 0x00068, 0x00331}, {0x01E97, 0x00074, 0x00308}, {0x01E98, 0x00077, 0x0030A},
+  {0x01E99, 0x00079, 0x0030A}, {0x01E9B, 0x0017F, 0x00307}, {0x01EA0, 0x00041, 0x00323}, {0x01EA1, 0x00061, 0x00323},
+  {0x01EA2, 0x00041, 0x00309}, {0x01EA3, 0x00061, 0x00309}, {0x01EA4, 0x000C2, 0x00301}, {0x01EA5, 0x000E2, 0x00301},
+  {0x01EA6, 0x000C2, 0x00300}, {0x01EA7, 0x000E2, 0x00300}, {0x01EA8, 0x000C2, 0x00309}, {0x01EA9, 0x000E2, 0x00309},
+  {0x01EAA, 0x000C2, 0x00303}, {0x01EAB, 0x000E2, 0x00303}, {0x01EAC, 0x01EA0, 0x00302}, {0x01EAD, 0x01EA1, 0x00302},
+  {0x01EAE, 0x00102, 0x00301}, {0x01EAF, 0x00103, 0x00301}, {0x01EB0, 0x00102, 0x00300}, {0x01EB1, 0x00103, 0x00300},
+  {0x01EB2, 0x00102, 0x00309}, {0x01EB3, 0x00103, 0x00309}, {0x01EB4, 0x00102, 0x00303}, {0x01EB5, 0x00103, 0x00303},
+  {0x01EB6, 0x01EA0, 0x00306}, {0x01EB7, 0x01EA1, 0x00306}, {0x01EB8, 0x00045, 0x00323}, {0x01EB9, 0x00065, 0x00323},
+  {0x01EBA, 0x00045, 0x00309}, {0x01EBB, 0x00065, 0x00309}, {0x01EBC, 0x00045, 0x00303}, {0x01EBD, 0x00065, 0x00303},
+  {0x01EBE, 0x000CA, 0x00301}, {0x01EBF, 0x000EA, 0x00301}, {0x01EC0, 0x000CA, 0x00300}, {0x01EC1, 0x000EA, 0x00300},
+  {0x01EC2, 0x000CA, 0x00309}, {0x01EC3, 0x000EA, 0x00309}, {0x01EC4, 0x000CA, 0x00303}, {0x01EC5, 0x000EA, 0x00303},
+  {0x01EC6, 0x01EB8, 0x00302}, {0x01EC7, 0x01EB9, 0x00302}, {0x01EC8, 0x00049, 0x00309}, {0x01EC9, 0x00069, 0x00309},
+  {0x01ECA, 0x00049, 0x00323}, {0x01ECB, 0x00069, 0x00323}, {0x01ECC, 0x0004F, 0x00323}, {0x01ECD, 0x0006F, 0x00323},
+  {0x01ECE, 0x0004F, 0x00309}, {0x01ECF, 0x0006F, 0x00309}, {0x01ED0, 0x000D4, 0x00301}, {0x01ED1, 0x000F4, 0x00301},
+  {0x01ED2, 0x000D4, 0x00300}, {0x01ED3, 0x000F4, 0x00300}, {0x01ED4, 0x000D4, 0x00309}, {0x01ED5, 0x000F4, 0x00309},
+  {0x01ED6, 0x000D4, 0x00303}, {0x01ED7, 0x000F4, 0x00303}, {0x01ED8, 0x01ECC, 0x00302}, {0x01ED9, 0x01ECD, 0x00302},
+  {0x01EDA, 0x001A0, 0x00301}, {0x01EDB, 0x001A1, 0x00301}, {0x01EDC, 0x001A0, 0x00300}, {0x01EDD, 0x001A1, 0x00300},
+  {0x01EDE, 0x001A0, 0x00309}, {0x01EDF, 0x001A1, 0x00309}, {0x01EE0, 0x001A0, 0x00303}, {0x01EE1, 0x001A1, 0x00303},
+  {0x01EE2, 0x001A0, 0x00323}, {0x01EE3, 0x001A1, 0x00323}, {0x01EE4, 0x00055, 0x00323}, {0x01EE5, 0x00075, 0x00323},
+  {0x01EE6, 0x00055, 0x00309}, {0x01EE7, 0x00075, 0x00309}, {0x01EE8, 0x001AF, 0x00301}, {0x01EE9, 0x001B0, 0x00301},
+  {0x01EEA, 0x001AF, 0x00300}, {0x01EEB, 0x001B0, 0x00300}, {0x01EEC, 0x001AF, 0x00309}, {0x01EED, 0x001B0, 0x00309},
+  {0x01EEE, 0x001AF, 0x00303}, {0x01EEF, 0x001B0, 0x00303}, {0x01EF0, 0x001AF, 0x00323}, {0x01EF1, 0x001B0, 0x00323},
+  {0x01EF2, 0x00059, 0x00300}, {0x01EF3, 0x00079, 0x00300}, {0x01EF4, 0x00059, 0x00323}, {0x01EF5, 0x00079, 0x00323},
+  {0x01EF6, 0x00059, 0x00309}, {0x01EF7, 0x00079, 0x00309}, {0x01EF8, 0x00059, 0x00303}, {0x01EF9, 0x00079, 0x00303},
+  {0x01F00, 0x003B1, 0x00313}, {0x01F01, 0x003B1, 0x00314}, {0x01F02, 0x01F00, 0x00300}, {0x01F03, 0x01F01, 0x00300},
+  {0x01F04, 0x01F00, 0x00301}, {0x01F05, 0x01F01, 0x00301}, {0x01F06, 0x01F00, 0x00342}, {0x01F07, 0x01F01, 0x00342},
+  {0x01F08, 0x00391, 0x00313}, {0x01F09, 0x00391, 0x00314}, {0x01F0A, 0x01F08, 0x00300}, {0x01F0B, 0x01F09, 0x00300},
+  {0x01F0C, 0x01F08, 0x00301}, {0x01F0D, 0x01F09, 0x00301}, {0x01F0E, 0x01F08, 0x00342}, {0x01F0F, 0x01F09, 0x00342},
+  {0x01F10, 0x003B5, 0x00313}, {0x01F11, 0x003B5, 0x00314}, {0x01F12, 0x01F10, 0x00300}, {0x01F13, 0x01F11, 0x00300},
+  {0x01F14, 0x01F10, 0x00301}, {0x01F15, 0x01F11, 0x00301}, {0x01F18, 0x00395, 0x00313}, {0x01F19, 0x00395, 0x00314},
+  {0x01F1A, 0x01F18, 0x00300}, {0x01F1B, 0x01F19, 0x00300}, {0x01F1C, 0x01F18, 0x00301}, {0x01F1D, 0x01F19, 0x00301},
+  {0x01F20, 0x003B7, 0x00313}, {0x01F21, 0x003B7, 0x00314}, {0x01F22, 0x01F20, 0x00300}, {0x01F23, 0x01F21, 0x00300},
+  {0x01F24, 0x01F20, 0x00301}, {0x01F25, 0x01F21, 0x00301}, {0x01F26, 0x01F20, 0x00342}, {0x01F27, 0x01F21, 0x00342},
+  {0x01F28, 0x00397, 0x00313}, {0x01F29, 0x00397, 0x00314}, {0x01F2A, 0x01F28, 0x00300}, {0x01F2B, 0x01F29, 0x00300},
+  {0x01F2C, 0x01F28, 0x00301}, {0x01F2D, 0x01F29, 0x00301}, {0x01F2E, 0x01F28, 0x00342}, {0x01F2F, 0x01F29, 0x00342},
+  {0x01F30, 0x003B9, 0x00313}, {0x01F31, 0x003B9, 0x00314}, {0x01F32, 0x01F30, 0x00300}, {0x01F33, 0x01F31, 0x00300},
+  {0x01F34, 0x01F30, 0x00301}, {0x01F35, 0x01F31, 0x00301}, {0x01F36, 0x01F30, 0x00342}, {0x01F37, 0x01F31, 0x00342},
+  {0x01F38, 0x00399, 0x00313}, {0x01F39, 0x00399, 0x00314}, {0x01F3A, 0x01F38, 0x00300}, {0x01F3B, 0x01F39, 0x00300},
+  {0x01F3C, 0x01F38, 0x00301}, {0x01F3D, 0x01F39, 0x00301}, {0x01F3E, 0x01F38, 0x00342}, {0x01F3F, 0x01F39, 0x00342},
+  {0x01F40, 0x003BF, 0x00313}, {0x01F41, 0x003BF, 0x00314}, {0x01F42, 0x01F40, 0x00300}, {0x01F43, 0x01F41, 0x00300},
+  {0x01F44, 0x01F40, 0x00301}, {0x01F45, 0x01F41, 0x00301}, {0x01F48, 0x0039F, 0x00313}, {0x01F49, 0x0039F, 0x00314},
+  {0x01F4A, 0x01F48, 0x00300}, {0x01F4B, 0x01F49, 0x00300}, {0x01F4C, 0x01F48, 0x00301}, {0x01F4D, 0x01F49, 0x00301},
+  {0x01F50, 0x003C5, 0x00313}, {0x01F51, 0x003C5, 0x00314}, {0x01F52, 0x01F50, 0x00300}, {0x01F53, 0x01F51, 0x00300},
+  {0x01F54, 0x01F50, 0x00301}, {0x01F55, 0x01F51, 0x00301}, {0x01F56, 0x01F50, 0x00342}, {0x01F57, 0x01F51, 0x00342},
+  {0x01F59, 0x003A5, 0x00314}, {0x01F5B, 0x01F59, 0x00300}, {0x01F5D, 0x01F59, 0x00301}, {0x01F5F, 0x01F59, 0x00342},
+  {0x01F60, 0x003C9, 0x00313}, {0x01F61, 0x003C9, 0x00314}, {0x01F62, 0x01F60, 0x00300}, {0x01F63, 0x01F61, 0x00300},
+  {0x01F64, 0x01F60, 0x00301}, {0x01F65, 0x01F61, 0x00301}, {0x01F66, 0x01F60, 0x00342}, {0x01F67, 0x01F61, 0x00342},
+  {0x01F68, 0x003A9, 0x00313}, {0x01F69, 0x003A9, 0x00314}, {0x01F6A, 0x01F68, 0x00300}, {0x01F6B, 0x01F69, 0x00300},
+  {0x01F6C, 0x01F68, 0x00301}, {0x01F6D, 0x01F69, 0x00301}, {0x01F6E, 0x01F68, 0x00342}, {0x01F6F, 0x01F69, 0x00342},
+  {0x01F70, 0x003B1, 0x00300}, {0x01F71, 0x003AC, 0x00000}, {0x01F72, 0x003B5, 0x00300}, {0x01F73, 0x003AD, 0x00000},
+  {0x01F74, 0x003B7, 0x00300}, {0x01F75, 0x003AE, 0x00000}, {0x01F76, 0x003B9, 0x00300}, {0x01F77, 0x003AF, 0x00000},
+  {0x01F78, 0x003BF, 0x00300}, {0x01F79, 0x003CC, 0x00000}, {0x01F7A, 0x003C5, 0x00300}, {0x01F7B, 0x003CD, 0x00000},
+  {0x01F7C, 0x003C9, 0x00300}, {0x01F7D, 0x003CE, 0x00000}, {0x01F80, 0x01F00, 0x00345}, {0x01F81, 0x01F01, 0x00345},
+  {0x01F82, 0x01F02, 0x00345}, {0x01F83, 0x01F03, 0x00345}, {0x01F84, 0x01F04, 0x00345}, {0x01F85, 0x01F05, 0x00345},
+  {0x01F86, 0x01F06, 0x00345}, {0x01F87, 0x01F07, 0x00345}, {0x01F88, 0x01F08, 0x00345}, {0x01F89, 0x01F09, 0x00345},
+  {0x01F8A, 0x01F0A, 0x00345}, {0x01F8B, 0x01F0B, 0x00345}, {0x01F8C, 0x01F0C, 0x00345}, {0x01F8D, 0x01F0D, 0x00345},
+  {0x01F8E, 0x01F0E, 0x00345}, {0x01F8F, 0x01F0F, 0x00345}, {0x01F90, 0x01F20, 0x00345}, {0x01F91, 0x01F21, 0x00345},
+  {0x01F92, 0x01F22, 0x00345}, {0x01F93, 0x01F23, 0x00345}, {0x01F94, 0x01F24, 0x00345}, {0x01F95, 0x01F25, 0x00345},
+  {0x01F96, 0x01F26, 0x00345}, {0x01F97, 0x01F27, 0x00345}, {0x01F98, 0x01F28, 0x00345}, {0x01F99, 0x01F29, 0x00345},
+  {0x01F9A, 0x01F2A, 0x00345}, {0x01F9B, 0x01F2B, 0x00345}, {0x01F9C, 0x01F2C, 0x00345}, {0x01F9D, 0x01F2D, 0x00345},
+  {0x01F9E, 0x01F2E, 0x00345}, {0x01F9F, 0x01F2F, 0x00345}, {0x01FA0, 0x01F60, 0x00345}, {0x01FA1, 0x01F61, 0x00345},
+  {0x01FA2, 0x01F62, 0x00345}, {0x01FA3, 0x01F63, 0x00345}, {0x01FA4, 0x01F64, 0x00345}, {0x01FA5, 0x01F65, 0x00345},
+  {0x01FA6, 0x01F66, 0x00345}, {0x01FA7, 0x01F67, 0x00345}, {0x01FA8, 0x01F68, 0x00345}, {0x01FA9, 0x01F69, 0x00345},
+  {0x01FAA, 0x01F6A, 0x00345}, {0x01FAB, 0x01F6B, 0x00345}, {0x01FAC, 0x01F6C, 0x00345}, {0x01FAD, 0x01F6D, 0x00345},
+  {0x01FAE, 0x01F6E, 0x00345}, {0x01FAF, 0x01F6F, 0x00345}, {0x01FB0, 0x003B1, 0x00306}, {0x01FB1, 0x003B1, 0x00304},
+  {0x01FB2, 0x01F70, 0x00345}, {0x01FB3, 0x003B1, 0x00345}, {0x01FB4, 0x003AC, 0x00345}, {0x01FB6, 0x003B1, 0x00342},
+  {0x01FB7, 0x01FB6, 0x00345}, {0x01FB8, 0x00391, 0x00306}, {0x01FB9, 0x00391, 0x00304}, {0x01FBA, 0x00391, 0x00300},
+  {0x01FBB, 0x00386, 0x00000}, {0x01FBC, 0x00391, 0x00345}, {0x01FBE, 0x003B9, 0x00000}, {0x01FC1, 0x000A8, 0x00342},
+  {0x01FC2, 0x01F74, 0x00345}, {0x01FC3, 0x003B7, 0x00345}, {0x01FC4, 0x003AE, 0x00345}, {0x01FC6, 0x003B7, 0x00342},
+  {0x01FC7, 0x01FC6, 0x00345}, {0x01FC8, 0x00395, 0x00300}, {0x01FC9, 0x00388, 0x00000}, {0x01FCA, 0x00397, 0x00300},
+  {0x01FCB, 0x00389, 0x00000}, {0x01FCC, 0x00397, 0x00345}, {0x01FCD, 0x01FBF, 0x00300}, {0x01FCE, 0x01FBF, 0x00301},
+  {0x01FCF, 0x01FBF, 0x00342}, {0x01FD0, 0x003B9, 0x00306}, {0x01FD1, 0x003B9, 0x00304}, {0x01FD2, 0x003CA, 0x00300},
+  {0x01FD3, 0x00390, 0x00000}, {0x01FD6, 0x003B9, 0x00342}, {0x01FD7, 0x003CA, 0x00342}, {0x01FD8, 0x00399, 0x00306},
+  {0x01FD9, 0x00399, 0x00304}, {0x01FDA, 0x00399, 0x00300}, {0x01FDB, 0x0038A, 0x00000}, {0x01FDD, 0x01FFE, 0x00300},
+  {0x01FDE, 0x01FFE, 0x00301}, {0x01FDF, 0x01FFE, 0x00342}, {0x01FE0, 0x003C5, 0x00306}, {0x01FE1, 0x003C5, 0x00304},
+  {0x01FE2, 0x003CB, 0x00300}, {0x01FE3, 0x003B0, 0x00000}, {0x01FE4, 0x003C1, 0x00313}, {0x01FE5, 0x003C1, 0x00314},
+  {0x01FE6, 0x003C5, 0x00342}, {0x01FE7, 0x003CB, 0x00342}, {0x01FE8, 0x003A5, 0x00306}, {0x01FE9, 0x003A5, 0x00304},
+  {0x01FEA, 0x003A5, 0x00300}, {0x01FEB, 0x0038E, 0x00000}, {0x01FEC, 0x003A1, 0x00314}, {0x01FED, 0x000A8, 0x00300},
+  {0x01FEE, 0x00385, 0x00000}, {0x01FEF, 0x00060, 0x00000}, {0x01FF2, 0x01F7C, 0x00345}, {0x01FF3, 0x003C9, 0x00345},
+  {0x01FF4, 0x003CE, 0x00345}, {0x01FF6, 0x003C9, 0x00342}, {0x01FF7, 0x01FF6, 0x00345}, {0x01FF8, 0x0039F, 0x00300},
+  {0x01FF9, 0x0038C, 0x00000}, {0x01FFA, 0x003A9, 0x00300}, {0x01FFB, 0x0038F, 0x00000}, {0x01FFC, 0x003A9, 0x00345},
+  {0x01FFD, 0x000B4, 0x00000}, {0x02000, 0x02002, 0x00000}, {0x02001, 0x02003, 0x00000}, {0x02126, 0x003A9, 0x00000},
+  {0x0212A, 0x0004B, 0x00000}, {0x0212B, 0x000C5, 0x00000}, {0x0219A, 0x02190, 0x00338}, {0x0219B, 0x02192, 0x00338},
+  {0x021AE, 0x02194, 0x00338}, {0x021CD, 0x021D0, 0x00338}, {0x021CE, 0x021D4, 0x00338}, {0x021CF, 0x021D2, 0x00338},
+  {0x02204, 0x02203, 0x00338}, {0x02209, 0x02208, 0x00338}, {0x0220C, 0x0220B, 0x00338}, {0x02224, 0x02223, 0x00338},
+  {0x02226, 0x02225, 0x00338}, {0x02241, 0x0223C, 0x00338}, {0x02244, 0x02243, 0x00338}, {0x02247, 0x02245, 0x00338},
+  {0x02249, 0x02248, 0x00338}, {0x02260, 0x0003D, 0x00338}, {0x02262, 0x02261, 0x00338}, {0x0226D, 0x0224D, 0x00338},
+  {0x0226E, 0x0003C, 0x00338}, {0x0226F, 0x0003E, 0x00338}, {0x02270, 0x02264, 0x00338}, {0x02271, 0x02265, 0x00338},
+  {0x02274, 0x02272, 0x00338}, {0x02275, 0x02273, 0x00338}, {0x02278, 0x02276, 0x00338}, {0x02279, 0x02277, 0x00338},
+  {0x02280, 0x0227A, 0x00338}, {0x02281, 0x0227B, 0x00338}, {0x02284, 0x02282, 0x00338}, {0x02285, 0x02283, 0x00338},
+  {0x02288, 0x02286, 0x00338}, {0x02289, 0x02287, 0x00338}, {0x022AC, 0x022A2, 0x00338}, {0x022AD, 0x022A8, 0x00338},
+  {0x022AE, 0x022A9, 0x00338}, {0x022AF, 0x022AB, 0x00338}, {0x022E0, 0x0227C, 0x00338}, {0x022E1, 0x0227D, 0x00338},
+  {0x022E2, 0x02291, 0x00338}, {0x022E3, 0x02292, 0x00338}, {0x022EA, 0x022B2, 0x00338}, {0x022EB, 0x022B3, 0x00338},
+  {0x022EC, 0x022B4, 0x00338}, {0x022ED, 0x022B5, 0x00338}, {0x02329, 0x03008, 0x00000}, {0x0232A, 0x03009, 0x00000},
+  {0x02ADC, 0x02ADD, 0x00338}, {0x0304C, 0x0304B, 0x03099}, {0x0304E, 0x0304D, 0x03099}, {0x03050, 0x0304F, 0x03099},
+  {0x03052, 0x03051, 0x03099}, {0x03054, 0x03053, 0x03099}, {0x03056, 0x03055, 0x03099}, {0x03058, 0x03057, 0x03099},
+  {0x0305A, 0x03059, 0x03099}, {0x0305C, 0x0305B, 0x03099}, {0x0305E, 0x0305D, 0x03099}, {0x03060, 0x0305F, 0x03099},
+  {0x03062, 0x03061, 0x03099}, {0x03065, 0x03064, 0x03099}, {0x03067, 0x03066, 0x03099}, {0x03069, 0x03068, 0x03099},
+  {0x03070, 0x0306F, 0x03099}, {0x03071, 0x0306F, 0x0309A}, {0x03073, 0x03072, 0x03099}, {0x03074, 0x03072, 0x0309A},
+  {0x03076, 0x03075, 0x03099}, {0x03077, 0x03075, 0x0309A}, {0x03079, 0x03078, 0x03099}, {0x0307A, 0x03078, 0x0309A},
+  {0x0307C, 0x0307B, 0x03099}, {0x0307D, 0x0307B, 0x0309A}, {0x03094, 0x03046, 0x03099}, {0x0309E, 0x0309D, 0x03099},
+  {0x030AC, 0x030AB, 0x03099}, {0x030AE, 0x030AD, 0x03099}, {0x030B0, 0x030AF, 0x03099}, {0x030B2, 0x030B1, 0x03099},
+  {0x030B4, 0x030B3, 0x03099}, {0x030B6, 0x030B5, 0x03099}, {0x030B8, 0x030B7, 0x03099}, {0x030BA, 0x030B9, 0x03099},
+  {0x030BC, 0x030BB, 0x03099}, {0x030BE, 0x030BD, 0x03099}, {0x030C0, 0x030BF, 0x03099}, {0x030C2, 0x030C1, 0x03099},
+  {0x030C5, 0x030C4, 0x03099}, {0x030C7, 0x030C6, 0x03099}, {0x030C9, 0x030C8, 0x03099}, {0x030D0, 0x030CF, 0x03099},
+  {0x030D1, 0x030CF, 0x0309A}, {0x030D3, 0x030D2, 0x03099}, {0x030D4, 0x030D2, 0x0309A}, {0x030D6, 0x030D5, 0x03099},
+  {0x030D7, 0x030D5, 0x0309A}, {0x030D9, 0x030D8, 0x03099}, {0x030DA, 0x030D8, 0x0309A}, {0x030DC, 0x030DB, 0x03099},
+  {0x030DD, 0x030DB, 0x0309A}, {0x030F4, 0x030A6, 0x03099}, {0x030F7, 0x030EF, 0x03099}, {0x030F8, 0x030F0, 0x03099},
+  {0x030F9, 0x030F1, 0x03099}, {0x030FA, 0x030F2, 0x03099}, {0x030FE, 0x030FD, 0x03099}, {0x0F900, 0x08C48, 0x00000},
+  {0x0F901, 0x066F4, 0x00000}, {0x0F902, 0x08ECA, 0x00000}, {0x0F903, 0x08CC8, 0x00000}, {0x0F904, 0x06ED1, 0x00000},
+  {0x0F905, 0x04E32, 0x00000}, {0x0F906, 0x053E5, 0x00000}, {0x0F907, 0x09F9C, 0x00000}, {0x0F908, 0x09F9C, 0x00000},
+  {0x0F909, 0x05951, 0x00000}, {0x0F90A, 0x091D1, 0x00000}, {0x0F90B, 0x05587, 0x00000}, {0x0F90C, 0x05948, 0x00000},
+  {0x0F90D, 0x061F6, 0x00000}, {0x0F90E, 0x07669, 0x00000}, {0x0F90F, 0x07F85, 0x00000}, {0x0F910, 0x0863F, 0x00000},
+  {0x0F911, 0x087BA, 0x00000}, {0x0F912, 0x088F8, 0x00000}, {0x0F913, 0x0908F, 0x00000}, {0x0F914, 0x06A02, 0x00000},
+  {0x0F915, 0x06D1B, 0x00000}, {0x0F916, 0x070D9, 0x00000}, {0x0F917, 0x073DE, 0x00000}, {0x0F918, 0x0843D, 0x00000},
+  {0x0F919, 0x0916A, 0x00000}, {0x0F91A, 0x099F1, 0x00000}, {0x0F91B, 0x04E82, 0x00000}, {0x0F91C, 0x05375, 0x00000},
+  {0x0F91D, 0x06B04, 0x00000}, {0x0F91E, 0x0721B, 0x00000}, {0x0F91F, 0x0862D, 0x00000}, {0x0F920, 0x09E1E, 0x00000},
+  {0x0F921, 0x05D50, 0x00000}, {0x0F922, 0x06FEB, 0x00000}, {0x0F923, 0x085CD, 0x00000}, {0x0F924, 0x08964, 0x00000},
+  {0x0F925, 0x062C9, 0x00000}, {0x0F926, 0x081D8, 0x00000}, {0x0F927, 0x0881F, 0x00000}, {0x0F928, 0x05ECA, 0x00000},
+  {0x0F929, 0x06717, 0x00000}, {0x0F92A, 0x06D6A, 0x00000}, {0x0F92B, 0x072FC, 0x00000}, {0x0F92C, 0x090CE, 0x00000},
+  {0x0F92D, 0x04F86, 0x00000}, {0x0F92E, 0x051B7, 0x00000}, {0x0F92F, 0x052DE, 0x00000}, {0x0F930, 0x064C4, 0x00000},
+  {0x0F931, 0x06AD3, 0x00000}, {0x0F932, 0x07210, 0x00000}, {0x0F933, 0x076E7, 0x00000}, {0x0F934, 0x08001, 0x00000},
+  {0x0F935, 0x08606, 0x00000}, {0x0F936, 0x0865C, 0x00000}, {0x0F937, 0x08DEF, 0x00000}, {0x0F938, 0x09732, 0x00000},
+  {0x0F939, 0x09B6F, 0x00000}, {0x0F93A, 0x09DFA, 0x00000}, {0x0F93B, 0x0788C, 0x00000}, {0x0F93C, 0x0797F, 0x00000},
+  {0x0F93D, 0x07DA0, 0x00000}, {0x0F93E, 0x083C9, 0x00000}, {0x0F93F, 0x09304, 0x00000}, {0x0F940, 0x09E7F, 0x00000},
+  {0x0F941, 0x08AD6, 0x00000}, {0x0F942, 0x058DF, 0x00000}, {0x0F943, 0x05F04, 0x00000}, {0x0F944, 0x07C60, 0x00000},
+  {0x0F945, 0x0807E, 0x00000}, {0x0F946, 0x07262, 0x00000}, {0x0F947, 0x078CA, 0x00000}, {0x0F948, 0x08CC2, 0x00000},
+  {0x0F949, 0x096F7, 0x00000}, {0x0F94A, 0x058D8, 0x00000}, {0x0F94B, 0x05C62, 0x00000}, {0x0F94C, 0x06A13, 0x00000},
+  {0x0F94D, 0x06DDA, 0x00000}, {0x0F94E, 0x06F0F, 0x00000}, {0x0F94F, 0x07D2F, 0x00000}, {0x0F950, 0x07E37, 0x00000},
+  {0x0F951, 0x0964B, 0x00000}, {0x0F952, 0x052D2, 0x00000}, {0x0F953, 0x0808B, 0x00000}, {0x0F954, 0x051DC, 0x00000},
+  {0x0F955, 0x051CC, 0x00000}, {0x0F956, 0x07A1C, 0x00000}, {0x0F957, 0x07DBE, 0x00000}, {0x0F958, 0x083F1, 0x00000},
+  {0x0F959, 0x09675, 0x00000}, {0x0F95A, 0x08B80, 0x00000}, {0x0F95B, 0x062CF, 0x00000}, {0x0F95C, 0x06A02, 0x00000},
+  {0x0F95D, 0x08AFE, 0x00000}, {0x0F95E, 0x04E39, 0x00000}, {0x0F95F, 0x05BE7, 0x00000}, {0x0F960, 0x06012, 0x00000},
+  {0x0F961, 0x07387, 0x00000}, {0x0F962, 0x07570, 0x00000}, {0x0F963, 0x05317, 0x00000}, {0x0F964, 0x078FB, 0x00000},
+  {0x0F965, 0x04FBF, 0x00000}, {0x0F966, 0x05FA9, 0x00000}, {0x0F967, 0x04E0D, 0x00000}, {0x0F968, 0x06CCC, 0x00000},
+  {0x0F969, 0x06578, 0x00000}, {0x0F96A, 0x07D22, 0x00000}, {0x0F96B, 0x053C3, 0x00000}, {0x0F96C, 0x0585E, 0x00000},
+  {0x0F96D, 0x07701, 0x00000}, {0x0F96E, 0x08449, 0x00000}, {0x0F96F, 0x08AAA, 0x00000}, {0x0F970, 0x06BBA, 0x00000},
+  {0x0F971, 0x08FB0, 0x00000}, {0x0F972, 0x06C88, 0x00000}, {0x0F973, 0x062FE, 0x00000}, {0x0F974, 0x082E5, 0x00000},
+  {0x0F975, 0x063A0, 0x00000}, {0x0F976, 0x07565, 0x00000}, {0x0F977, 0x04EAE, 0x00000}, {0x0F978, 0x05169, 0x00000},
+  {0x0F979, 0x051C9, 0x00000}, {0x0F97A, 0x06881, 0x00000}, {0x0F97B, 0x07CE7, 0x00000}, {0x0F97C, 0x0826F, 0x00000},
+  {0x0F97D, 0x08AD2, 0x00000}, {0x0F97E, 0x091CF, 0x00000}, {0x0F97F, 0x052F5, 0x00000}, {0x0F980, 0x05442, 0x00000},
+  {0x0F981, 0x05973, 0x00000}, {0x0F982, 0x05EEC, 0x00000}, {0x0F983, 0x065C5, 0x00000}, {0x0F984, 0x06FFE, 0x00000},
+  {0x0F985, 0x0792A, 0x00000}, {0x0F986, 0x095AD, 0x00000}, {0x0F987, 0x09A6A, 0x00000}, {0x0F988, 0x09E97, 0x00000},
+  {0x0F989, 0x09ECE, 0x00000}, {0x0F98A, 0x0529B, 0x00000}, {0x0F98B, 0x066C6, 0x00000}, {0x0F98C, 0x06B77, 0x00000},
+  {0x0F98D, 0x08F62, 0x00000}, {0x0F98E, 0x05E74, 0x00000}, {0x0F98F, 0x06190, 0x00000}, {0x0F990, 0x06200, 0x00000},
+  {0x0F991, 0x0649A, 0x00000}, {0x0F992, 0x06F23, 0x00000}, {0x0F993, 0x07149, 0x00000}, {0x0F994, 0x07489, 0x00000},
+  {0x0F995, 0x079CA, 0x00000}, {0x0F996, 0x07DF4, 0x00000}, {0x0F997, 0x0806F, 0x00000}, {0x0F998, 0x08F26, 0x00000},
+  {0x0F999, 0x084EE, 0x00000}, {0x0F99A, 0x09023, 0x00000}, {0x0F99B, 0x0934A, 0x00000}, {0x0F99C, 0x05217, 0x00000},
+  {0x0F99D, 0x052A3, 0x00000}, {0x0F99E, 0x054BD, 0x00000}, {0x0F99F, 0x070C8, 0x00000}, {0x0F9A0, 0x088C2, 0x00000},
+  {0x0F9A1, 0x08AAA, 0x00000}, {0x0F9A2, 0x05EC9, 0x00000}, {0x0F9A3, 0x05FF5, 0x00000}, {0x0F9A4, 0x0637B, 0x00000},
+  {0x0F9A5, 0x06BAE, 0x00000}, {0x0F9A6, 0x07C3E, 0x00000}, {0x0F9A7, 0x07375, 0x00000}, {0x0F9A8, 0x04EE4, 0x00000},
+  {0x0F9A9, 0x056F9, 0x00000}, {0x0F9AA, 0x05BE7, 0x00000}, {0x0F9AB, 0x05DBA, 0x00000}, {0x0F9AC, 0x0601C, 0x00000},
+  {0x0F9AD, 0x073B2, 0x00000}, {0x0F9AE, 0x07469, 0x00000}, {0x0F9AF, 0x07F9A, 0x00000}, {0x0F9B0, 0x08046, 0x00000},
+  {0x0F9B1, 0x09234, 0x00000}, {0x0F9B2, 0x096F6, 0x00000}, {0x0F9B3, 0x09748, 0x00000}, {0x0F9B4, 0x09818, 0x00000},
+  {0x0F9B5, 0x04F8B, 0x00000}, {0x0F9B6, 0x079AE, 0x00000}, {0x0F9B7, 0x091B4, 0x00000}, {0x0F9B8, 0x096B8, 0x00000},
+  {0x0F9B9, 0x060E1, 0x00000}, {0x0F9BA, 0x04E86, 0x00000}, {0x0F9BB, 0x050DA, 0x00000}, {0x0F9BC, 0x05BEE, 0x00000},
+  {0x0F9BD, 0x05C3F, 0x00000}, {0x0F9BE, 0x06599, 0x00000}, {0x0F9BF, 0x06A02, 0x00000}, {0x0F9C0, 0x071CE, 0x00000},
+  {0x0F9C1, 0x07642, 0x00000}, {0x0F9C2, 0x084FC, 0x00000}, {0x0F9C3, 0x0907C, 0x00000}, {0x0F9C4, 0x09F8D, 0x00000},
+  {0x0F9C5, 0x06688, 0x00000}, {0x0F9C6, 0x0962E, 0x00000}, {0x0F9C7, 0x05289, 0x00000}, {0x0F9C8, 0x0677B, 0x00000},
+  {0x0F9C9, 0x067F3, 0x00000}, {0x0F9CA, 0x06D41, 0x00000}, {0x0F9CB, 0x06E9C, 0x00000}, {0x0F9CC, 0x07409, 0x00000},
+  {0x0F9CD, 0x07559, 0x00000}, {0x0F9CE, 0x0786B, 0x00000}, {0x0F9CF, 0x07D10, 0x00000}, {0x0F9D0, 0x0985E, 0x00000},
+  {0x0F9D1, 0x0516D, 0x00000}, {0x0F9D2, 0x0622E, 0x00000}, {0x0F9D3, 0x09678, 0x00000}, {0x0F9D4, 0x0502B, 0x00000},
+  {0x0F9D5, 0x05D19, 0x00000}, {0x0F9D6, 0x06DEA, 0x00000}, {0x0F9D7, 0x08F2A, 0x00000}, {0x0F9D8, 0x05F8B, 0x00000},
+  {0x0F9D9, 0x06144, 0x00000}, {0x0F9DA, 0x06817, 0x00000}, {0x0F9DB, 0x07387, 0x00000}, {0x0F9DC, 0x09686, 0x00000},
+  {0x0F9DD, 0x05229, 0x00000}, {0x0F9DE, 0x0540F, 0x00000}, {0x0F9DF, 0x05C65, 0x00000}, {0x0F9E0, 0x06613, 0x00000},
+  {0x0F9E1, 0x0674E, 0x00000}, {0x0F9E2, 0x068A8, 0x00000}, {0x0F9E3, 0x06CE5, 0x00000}, {0x0F9E4, 0x07406, 0x00000},
+  {0x0F9E5, 0x075E2, 0x00000}, {0x0F9E6, 0x07F79, 0x00000}, {0x0F9E7, 0x088CF, 0x00000}, {0x0F9E8, 0x088E1, 0x00000},
+  {0x0F9E9, 0x091CC, 0x00000}, {0x0F9EA, 0x096E2, 0x00000}, {0x0F9EB, 0x0533F, 0x00000}, {0x0F9EC, 0x06EBA, 0x00000},
+  {0x0F9ED, 0x0541D, 0x00000}, {0x0F9EE, 0x071D0, 0x00000}, {0x0F9EF, 0x07498, 0x00000}, {0x0F9F0, 0x085FA, 0x00000},
+  {0x0F9F1, 0x096A3, 0x00000}, {0x0F9F2, 0x09C57, 0x00000}, {0x0F9F3, 0x09E9F, 0x00000}, {0x0F9F4, 0x06797, 0x00000},
+  {0x0F9F5, 0x06DCB, 0x00000}, {0x0F9F6, 0x081E8, 0x00000}, {0x0F9F7, 0x07ACB, 0x00000}, {0x0F9F8, 0x07B20, 0x00000},
+  {0x0F9F9, 0x07C92, 0x00000}, {0x0F9FA, 0x072C0, 0x00000}, {0x0F9FB, 0x07099, 0x00000}, {0x0F9FC, 0x08B58, 0x00000},
+  {0x0F9FD, 0x04EC0, 0x00000}, {0x0F9FE, 0x08336, 0x00000}, {0x0F9FF, 0x0523A, 0x00000}, {0x0FA00, 0x05207, 0x00000},
+  {0x0FA01, 0x05EA6, 0x00000}, {0x0FA02, 0x062D3, 0x00000}, {0x0FA03, 0x07CD6, 0x00000}, {0x0FA04, 0x05B85, 0x00000},
+  {0x0FA05, 0x06D1E, 0x00000}, {0x0FA06, 0x066B4, 0x00000}, {0x0FA07, 0x08F3B, 0x00000}, {0x0FA08, 0x0884C, 0x00000},
+  {0x0FA09, 0x0964D, 0x00000}, {0x0FA0A, 0x0898B, 0x00000}, {0x0FA0B, 0x05ED3, 0x00000}, {0x0FA0C, 0x05140, 0x00000},
+  {0x0FA0D, 0x055C0, 0x00000}, {0x0FA10, 0x0585A, 0x00000}, {0x0FA12, 0x06674, 0x00000}, {0x0FA15, 0x051DE, 0x00000},
+  {0x0FA16, 0x0732A, 0x00000}, {0x0FA17, 0x076CA, 0x00000}, {0x0FA18, 0x0793C, 0x00000}, {0x0FA19, 0x0795E, 0x00000},
+  {0x0FA1A, 0x07965, 0x00000}, {0x0FA1B, 0x0798F, 0x00000}, {0x0FA1C, 0x09756, 0x00000}, {0x0FA1D, 0x07CBE, 0x00000},
+  {0x0FA1E, 0x07FBD, 0x00000}, {0x0FA20, 0x08612, 0x00000}, {0x0FA22, 0x08AF8, 0x00000}, {0x0FA25, 0x09038, 0x00000},
+  {0x0FA26, 0x090FD, 0x00000}, {0x0FA2A, 0x098EF, 0x00000}, {0x0FA2B, 0x098FC, 0x00000}, {0x0FA2C, 0x09928, 0x00000},
+  {0x0FA2D, 0x09DB4, 0x00000}, {0x0FA2E, 0x090DE, 0x00000}, {0x0FA2F, 0x096B7, 0x00000}, {0x0FA30, 0x04FAE, 0x00000},
+  {0x0FA31, 0x050E7, 0x00000}, {0x0FA32, 0x0514D, 0x00000}, {0x0FA33, 0x052C9, 0x00000}, {0x0FA34, 0x052E4, 0x00000},
+  {0x0FA35, 0x05351, 0x00000}, {0x0FA36, 0x0559D, 0x00000}, {0x0FA37, 0x05606, 0x00000}, {0x0FA38, 0x05668, 0x00000},
+  {0x0FA39, 0x05840, 0x00000}, {0x0FA3A, 0x058A8, 0x00000}, {0x0FA3B, 0x05C64, 0x00000}, {0x0FA3C, 0x05C6E, 0x00000},
+  {0x0FA3D, 0x06094, 0x00000}, {0x0FA3E, 0x06168, 0x00000}, {0x0FA3F, 0x0618E, 0x00000}, {0x0FA40, 0x061F2, 0x00000},
+  {0x0FA41, 0x0654F, 0x00000}, {0x0FA42, 0x065E2, 0x00000}, {0x0FA43, 0x06691, 0x00000}, {0x0FA44, 0x06885, 0x00000},
+  {0x0FA45, 0x06D77, 0x00000}, {0x0FA46, 0x06E1A, 0x00000}, {0x0FA47, 0x06F22, 0x00000}, {0x0FA48, 0x0716E, 0x00000},
+  {0x0FA49, 0x0722B, 0x00000}, {0x0FA4A, 0x07422, 0x00000}, {0x0FA4B, 0x07891, 0x00000}, {0x0FA4C, 0x0793E, 0x00000},
+  {0x0FA4D, 0x07949, 0x00000}, {0x0FA4E, 0x07948, 0x00000}, {0x0FA4F, 0x07950, 0x00000}, {0x0FA50, 0x07956, 0x00000},
+  {0x0FA51, 0x0795D, 0x00000}, {0x0FA52, 0x0798D, 0x00000}, {0x0FA53, 0x0798E, 0x00000}, {0x0FA54, 0x07A40, 0x00000},
+  {0x0FA55, 0x07A81, 0x00000}, {0x0FA56, 0x07BC0, 0x00000}, {0x0FA57, 0x07DF4, 0x00000}, {0x0FA58, 0x07E09, 0x00000},
+  {0x0FA59, 0x07E41, 0x00000}, {0x0FA5A, 0x07F72, 0x00000}, {0x0FA5B, 0x08005, 0x00000}, {0x0FA5C, 0x081ED, 0x00000},
+  {0x0FA5D, 0x08279, 0x00000}, {0x0FA5E, 0x08279, 0x00000}, {0x0FA5F, 0x08457, 0x00000}, {0x0FA60, 0x08910, 0x00000},
+  {0x0FA61, 0x08996, 0x00000}, {0x0FA62, 0x08B01, 0x00000}, {0x0FA63, 0x08B39, 0x00000}, {0x0FA64, 0x08CD3, 0x00000},
+  {0x0FA65, 0x08D08, 0x00000}, {0x0FA66, 0x08FB6, 0x00000}, {0x0FA67, 0x09038, 0x00000}, {0x0FA68, 0x096E3, 0x00000},
+  {0x0FA69, 0x097FF, 0x00000}, {0x0FA6A, 0x0983B, 0x00000}, {0x0FA6B, 0x06075, 0x00000}, {0x0FA6C, 0x242EE, 0x00000},
+  {0x0FA6D, 0x08218, 0x00000}, {0x0FA70, 0x04E26, 0x00000}, {0x0FA71, 0x051B5, 0x00000}, {0x0FA72, 0x05168, 0x00000},
+  {0x0FA73, 0x04F80, 0x00000}, {0x0FA74, 0x05145, 0x00000}, {0x0FA75, 0x05180, 0x00000}, {0x0FA76, 0x052C7, 0x00000},
+  {0x0FA77, 0x052FA, 0x00000}, {0x0FA78, 0x0559D, 0x00000}, {0x0FA79, 0x05555, 0x00000}, {0x0FA7A, 0x05599, 0x00000},
+  {0x0FA7B, 0x055E2, 0x00000}, {0x0FA7C, 0x0585A, 0x00000}, {0x0FA7D, 0x058B3, 0x00000}, {0x0FA7E, 0x05944, 0x00000},
+  {0x0FA7F, 0x05954, 0x00000}, {0x0FA80, 0x05A62, 0x00000}, {0x0FA81, 0x05B28, 0x00000}, {0x0FA82, 0x05ED2, 0x00000},
+  {0x0FA83, 0x05ED9, 0x00000}, {0x0FA84, 0x05F69, 0x00000}, {0x0FA85, 0x05FAD, 0x00000}, {0x0FA86, 0x060D8, 0x00000},
+  {0x0FA87, 0x0614E, 0x00000}, {0x0FA88, 0x06108, 0x00000}, {0x0FA89, 0x0618E, 0x00000}, {0x0FA8A, 0x06160, 0x00000},
+  {0x0FA8B, 0x061F2, 0x00000}, {0x0FA8C, 0x06234, 0x00000}, {0x0FA8D, 0x063C4, 0x00000}, {0x0FA8E, 0x0641C, 0x00000},
+  {0x0FA8F, 0x06452, 0x00000}, {0x0FA90, 0x06556, 0x00000}, {0x0FA91, 0x06674, 0x00000}, {0x0FA92, 0x06717, 0x00000},
+  {0x0FA93, 0x0671B, 0x00000}, {0x0FA94, 0x06756, 0x00000}, {0x0FA95, 0x06B79, 0x00000}, {0x0FA96, 0x06BBA, 0x00000},
+  {0x0FA97, 0x06D41, 0x00000}, {0x0FA98, 0x06EDB, 0x00000}, {0x0FA99, 0x06ECB, 0x00000}, {0x0FA9A, 0x06F22, 0x00000},
+  {0x0FA9B, 0x0701E, 0x00000}, {0x0FA9C, 0x0716E, 0x00000}, {0x0FA9D, 0x077A7, 0x00000}, {0x0FA9E, 0x07235, 0x00000},
+  {0x0FA9F, 0x072AF, 0x00000}, {0x0FAA0, 0x0732A, 0x00000}, {0x0FAA1, 0x07471, 0x00000}, {0x0FAA2, 0x07506, 0x00000},
+  {0x0FAA3, 0x0753B, 0x00000}, {0x0FAA4, 0x0761D, 0x00000}, {0x0FAA5, 0x0761F, 0x00000}, {0x0FAA6, 0x076CA, 0x00000},
+  {0x0FAA7, 0x076DB, 0x00000}, {0x0FAA8, 0x076F4, 0x00000}, {0x0FAA9, 0x0774A, 0x00000}, {0x0FAAA, 0x07740, 0x00000},
+  {0x0FAAB, 0x078CC, 0x00000}, {0x0FAAC, 0x07AB1, 0x00000}, {0x0FAAD, 0x07BC0, 0x00000}, {0x0FAAE, 0x07C7B, 0x00000},
+  {0x0FAAF, 0x07D5B, 0x00000}, {0x0FAB0, 0x07DF4, 0x00000}, {0x0FAB1, 0x07F3E, 0x00000}, {0x0FAB2, 0x08005, 0x00000},
+  {0x0FAB3, 0x08352, 0x00000}, {0x0FAB4, 0x083EF, 0x00000}, {0x0FAB5, 0x08779, 0x00000}, {0x0FAB6, 0x08941, 0x00000},
+  {0x0FAB7, 0x08986, 0x00000}, {0x0FAB8, 0x08996, 0x00000}, {0x0FAB9, 0x08ABF, 0x00000}, {0x0FABA, 0x08AF8, 0x00000},
+  {0x0FABB, 0x08ACB, 0x00000}, {0x0FABC, 0x08B01, 0x00000}, {0x0FABD, 0x08AFE, 0x00000}, {0x0FABE, 0x08AED, 0x00000},
+  {0x0FABF, 0x08B39, 0x00000}, {0x0FAC0, 0x08B8A, 0x00000}, {0x0FAC1, 0x08D08, 0x00000}, {0x0FAC2, 0x08F38, 0x00000},
+  {0x0FAC3, 0x09072, 0x00000}, {0x0FAC4, 0x09199, 0x00000}, {0x0FAC5, 0x09276, 0x00000}, {0x0FAC6, 0x0967C, 0x00000},
+  {0x0FAC7, 0x096E3, 0x00000}, {0x0FAC8, 0x09756, 0x00000}, {0x0FAC9, 0x097DB, 0x00000}, {0x0FACA, 0x097FF, 0x00000},
+  {0x0FACB, 0x0980B, 0x00000}, {0x0FACC, 0x0983B, 0x00000}, {0x0FACD, 0x09B12, 0x00000}, {0x0FACE, 0x09F9C, 0x00000},
+  {0x0FACF, 0x2284A, 0x00000}, {0x0FAD0, 0x22844, 0x00000}, {0x0FAD1, 0x233D5, 0x00000}, {0x0FAD2, 0x03B9D, 0x00000},
+  {0x0FAD3, 0x04018, 0x00000}, {0x0FAD4, 0x04039, 0x00000}, {0x0FAD5, 0x25249, 0x00000}, {0x0FAD6, 0x25CD0, 0x00000},
+  {0x0FAD7, 0x27ED3, 0x00000}, {0x0FAD8, 0x09F43, 0x00000}, {0x0FAD9, 0x09F8E, 0x00000}, {0x0FB1D, 0x005D9, 0x005B4},
+  {0x0FB1F, 0x005F2, 0x005B7}, {0x0FB2A, 0x005E9, 0x005C1}, {0x0FB2B, 0x005E9, 0x005C2}, {0x0FB2C, 0x0FB49, 0x005C1},
+  {0x0FB2D, 0x0FB49, 0x005C2}, {0x0FB2E, 0x005D0, 0x005B7}, {0x0FB2F, 0x005D0, 0x005B8}, {0x0FB30, 0x005D0, 0x005BC},
+  {0x0FB31, 0x005D1, 0x005BC}, {0x0FB32, 0x005D2, 0x005BC}, {0x0FB33, 0x005D3, 0x005BC}, {0x0FB34, 0x005D4, 0x005BC},
+  {0x0FB35, 0x005D5, 0x005BC}, {0x0FB36, 0x005D6, 0x005BC}, {0x0FB38, 0x005D8, 0x005BC}, {0x0FB39, 0x005D9, 0x005BC},
+  {0x0FB3A, 0x005DA, 0x005BC}, {0x0FB3B, 0x005DB, 0x005BC}, {0x0FB3C, 0x005DC, 0x005BC}, {0x0FB3E, 0x005DE, 0x005BC},
+  {0x0FB40, 0x005E0, 0x005BC}, {0x0FB41, 0x005E1, 0x005BC}, {0x0FB43, 0x005E3, 0x005BC}, {0x0FB44, 0x005E4, 0x005BC},
+  {0x0FB46, 0x005E6, 0x005BC}, {0x0FB47, 0x005E7, 0x005BC}, {0x0FB48, 0x005E8, 0x005BC}, {0x0FB49, 0x005E9, 0x005BC},
+  {0x0FB4A, 0x005EA, 0x005BC}, {0x0FB4B, 0x005D5, 0x005B9}, {0x0FB4C, 0x005D1, 0x005BF}, {0x0FB4D, 0x005DB, 0x005BF},
+  {0x0FB4E, 0x005E4, 0x005BF}, {0x1109A, 0x11099, 0x110BA}, {0x1109C, 0x1109B, 0x110BA}, {0x110AB, 0x110A5, 0x110BA},
+  {0x1112E, 0x11131, 0x11127}, {0x1112F, 0x11132, 0x11127}, {0x1134B, 0x11347, 0x1133E}, {0x1134C, 0x11347, 0x11357},
+  {0x114BB, 0x114B9, 0x114BA}, {0x114BC, 0x114B9, 0x114B0}, {0x114BE, 0x114B9, 0x114BD}, {0x115BA, 0x115B8, 0x115AF},
+  {0x115BB, 0x115B9, 0x115AF}, {0x11938, 0x11935, 0x11930}, {0x1D15E, 0x1D157, 0x1D165}, {0x1D15F, 0x1D158, 0x1D165},
+  {0x1D160, 0x1D15F, 0x1D16E}, {0x1D161, 0x1D15F, 0x1D16F}, {0x1D162, 0x1D15F, 0x1D170}, {0x1D163, 0x1D15F, 0x1D171},
+  {0x1D164, 0x1D15F, 0x1D172}, {0x1D1BB, 0x1D1B9, 0x1D165}, {0x1D1BC, 0x1D1BA, 0x1D165}, {0x1D1BD, 0x1D1BB, 0x1D16E},
+  {0x1D1BE, 0x1D1BC, 0x1D16E}, {0x1D1BF, 0x1D1BB, 0x1D16F}, {0x1D1C0, 0x1D1BC, 0x1D16F}, {0x2F800, 0x04E3D, 0x00000},
+  {0x2F801, 0x04E38, 0x00000}, {0x2F802, 0x04E41, 0x00000}, {0x2F803, 0x20122, 0x00000}, {0x2F804, 0x04F60, 0x00000},
+  {0x2F805, 0x04FAE, 0x00000}, {0x2F806, 0x04FBB, 0x00000}, {0x2F807, 0x05002, 0x00000}, {0x2F808, 0x0507A, 0x00000},
+  {0x2F809, 0x05099, 0x00000}, {0x2F80A, 0x050E7, 0x00000}, {0x2F80B, 0x050CF, 0x00000}, {0x2F80C, 0x0349E, 0x00000},
+  {0x2F80D, 0x2063A, 0x00000}, {0x2F80E, 0x0514D, 0x00000}, {0x2F80F, 0x05154, 0x00000}, {0x2F810, 0x05164, 0x00000},
+  {0x2F811, 0x05177, 0x00000}, {0x2F812, 0x2051C, 0x00000}, {0x2F813, 0x034B9, 0x00000}, {0x2F814, 0x05167, 0x00000},
+  {0x2F815, 0x0518D, 0x00000}, {0x2F816, 0x2054B, 0x00000}, {0x2F817, 0x05197, 0x00000}, {0x2F818, 0x051A4, 0x00000},
+  {0x2F819, 0x04ECC, 0x00000}, {0x2F81A, 0x051AC, 0x00000}, {0x2F81B, 0x051B5, 0x00000}, {0x2F81C, 0x291DF, 0x00000},
+  {0x2F81D, 0x051F5, 0x00000}, {0x2F81E, 0x05203, 0x00000}, {0x2F81F, 0x034DF, 0x00000}, {0x2F820, 0x0523B, 0x00000},
+  {0x2F821, 0x05246, 0x00000}, {0x2F822, 0x05272, 0x00000}, {0x2F823, 0x05277, 0x00000}, {0x2F824, 0x03515, 0x00000},
+  {0x2F825, 0x052C7, 0x00000}, {0x2F826, 0x052C9, 0x00000}, {0x2F827, 0x052E4, 0x00000}, {0x2F828, 0x052FA, 0x00000},
+  {0x2F829, 0x05305, 0x00000}, {0x2F82A, 0x05306, 0x00000}, {0x2F82B, 0x05317, 0x00000}, {0x2F82C, 0x05349, 0x00000},
+  {0x2F82D, 0x05351, 0x00000}, {0x2F82E, 0x0535A, 0x00000}, {0x2F82F, 0x05373, 0x00000}, {0x2F830, 0x0537D, 0x00000},
+  {0x2F831, 0x0537F, 0x00000}, {0x2F832, 0x0537F, 0x00000}, {0x2F833, 0x0537F, 0x00000}, {0x2F834, 0x20A2C, 0x00000},
+  {0x2F835, 0x07070, 0x00000}, {0x2F836, 0x053CA, 0x00000}, {0x2F837, 0x053DF, 0x00000}, {0x2F838, 0x20B63, 0x00000},
+  {0x2F839, 0x053EB, 0x00000}, {0x2F83A, 0x053F1, 0x00000}, {0x2F83B, 0x05406, 0x00000}, {0x2F83C, 0x0549E, 0x00000},
+  {0x2F83D, 0x05438, 0x00000}, {0x2F83E, 0x05448, 0x00000}, {0x2F83F, 0x05468, 0x00000}, {0x2F840, 0x054A2, 0x00000},
+  {0x2F841, 0x054F6, 0x00000}, {0x2F842, 0x05510, 0x00000}, {0x2F843, 0x05553, 0x00000}, {0x2F844, 0x05563, 0x00000},
+  {0x2F845, 0x05584, 0x00000}, {0x2F846, 0x05584, 0x00000}, {0x2F847, 0x05599, 0x00000}, {0x2F848, 0x055AB, 0x00000},
+  {0x2F849, 0x055B3, 0x00000}, {0x2F84A, 0x055C2, 0x00000}, {0x2F84B, 0x05716, 0x00000}, {0x2F84C, 0x05606, 0x00000},
+  {0x2F84D, 0x05717, 0x00000}, {0x2F84E, 0x05651, 0x00000}, {0x2F84F, 0x05674, 0x00000}, {0x2F850, 0x05207, 0x00000},
+  {0x2F851, 0x058EE, 0x00000}, {0x2F852, 0x057CE, 0x00000}, {0x2F853, 0x057F4, 0x00000}, {0x2F854, 0x0580D, 0x00000},
+  {0x2F855, 0x0578B, 0x00000}, {0x2F856, 0x05832, 0x00000}, {0x2F857, 0x05831, 0x00000}, {0x2F858, 0x058AC, 0x00000},
+  {0x2F859, 0x214E4, 0x00000}, {0x2F85A, 0x058F2, 0x00000}, {0x2F85B, 0x058F7, 0x00000}, {0x2F85C, 0x05906, 0x00000},
+  {0x2F85D, 0x0591A, 0x00000}, {0x2F85E, 0x05922, 0x00000}, {0x2F85F, 0x05962, 0x00000}, {0x2F860, 0x216A8, 0x00000},
+  {0x2F861, 0x216EA, 0x00000}, {0x2F862, 0x059EC, 0x00000}, {0x2F863, 0x05A1B, 0x00000}, {0x2F864, 0x05A27, 0x00000},
+  {0x2F865, 0x059D8, 0x00000}, {0x2F866, 0x05A66, 0x00000}, {0x2F867, 0x036EE, 0x00000}, {0x2F868, 0x036FC, 0x00000},
+  {0x2F869, 0x05B08, 0x00000}, {0x2F86A, 0x05B3E, 0x00000}, {0x2F86B, 0x05B3E, 0x00000}, {0x2F86C, 0x219C8, 0x00000},
+  {0x2F86D, 0x05BC3, 0x00000}, {0x2F86E, 0x05BD8, 0x00000}, {0x2F86F, 0x05BE7, 0x00000}, {0x2F870, 0x05BF3, 0x00000},
+  {0x2F871, 0x21B18, 0x00000}, {0x2F872, 0x05BFF, 0x00000}, {0x2F873, 0x05C06, 0x00000}, {0x2F874, 0x05F53, 0x00000},
+  {0x2F875, 0x05C22, 0x00000}, {0x2F876, 0x03781, 0x00000}, {0x2F877, 0x05C60, 0x00000}, {0x2F878, 0x05C6E, 0x00000},
+  {0x2F879, 0x05CC0, 0x00000}, {0x2F87A, 0x05C8D, 0x00000}, {0x2F87B, 0x21DE4, 0x00000}, {0x2F87C, 0x05D43, 0x00000},
+  {0x2F87D, 0x21DE6, 0x00000}, {0x2F87E, 0x05D6E, 0x00000}, {0x2F87F, 0x05D6B, 0x00000}, {0x2F880, 0x05D7C, 0x00000},
+  {0x2F881, 0x05DE1, 0x00000}, {0x2F882, 0x05DE2, 0x00000}, {0x2F883, 0x0382F, 0x00000}, {0x2F884, 0x05DFD, 0x00000},
+  {0x2F885, 0x05E28, 0x00000}, {0x2F886, 0x05E3D, 0x00000}, {0x2F887, 0x05E69, 0x00000}, {0x2F888, 0x03862, 0x00000},
+  {0x2F889, 0x22183, 0x00000}, {0x2F88A, 0x0387C, 0x00000}, {0x2F88B, 0x05EB0, 0x00000}, {0x2F88C, 0x05EB3, 0x00000},
+  {0x2F88D, 0x05EB6, 0x00000}, {0x2F88E, 0x05ECA, 0x00000}, {0x2F88F, 0x2A392, 0x00000}, {0x2F890, 0x05EFE, 0x00000},
+  {0x2F891, 0x22331, 0x00000}, {0x2F892, 0x22331, 0x00000}, {0x2F893, 0x08201, 0x00000}, {0x2F894, 0x05F22, 0x00000},
+  {0x2F895, 0x05F22, 0x00000}, {0x2F896, 0x038C7, 0x00000}, {0x2F897, 0x232B8, 0x00000}, {0x2F898, 0x261DA, 0x00000},
+  {0x2F899, 0x05F62, 0x00000}, {0x2F89A, 0x05F6B, 0x00000}, {0x2F89B, 0x038E3, 0x00000}, {0x2F89C, 0x05F9A, 0x00000},
+  {0x2F89D, 0x05FCD, 0x00000}, {0x2F89E, 0x05FD7, 0x00000}, {0x2F89F, 0x05FF9, 0x00000}, {0x2F8A0, 0x06081, 0x00000},
+  {0x2F8A1, 0x0393A, 0x00000}, {0x2F8A2, 0x0391C, 0x00000}, {0x2F8A3, 0x06094, 0x00000}, {0x2F8A4, 0x226D4, 0x00000},
+  {0x2F8A5, 0x060C7, 0x00000}, {0x2F8A6, 0x06148, 0x00000}, {0x2F8A7, 0x0614C, 0x00000}, {0x2F8A8, 0x0614E, 0x00000},
+  {0x2F8A9, 0x0614C, 0x00000}, {0x2F8AA, 0x0617A, 0x00000}, {0x2F8AB, 0x0618E, 0x00000}, {0x2F8AC, 0x061B2, 0x00000},
+  {0x2F8AD, 0x061A4, 0x00000}, {0x2F8AE, 0x061AF, 0x00000}, {0x2F8AF, 0x061DE, 0x00000}, {0x2F8B0, 0x061F2, 0x00000},
+  {0x2F8B1, 0x061F6, 0x00000}, {0x2F8B2, 0x06210, 0x00000}, {0x2F8B3, 0x0621B, 0x00000}, {0x2F8B4, 0x0625D, 0x00000},
+  {0x2F8B5, 0x062B1, 0x00000}, {0x2F8B6, 0x062D4, 0x00000}, {0x2F8B7, 0x06350, 0x00000}, {0x2F8B8, 0x22B0C, 0x00000},
+  {0x2F8B9, 0x0633D, 0x00000}, {0x2F8BA, 0x062FC, 0x00000}, {0x2F8BB, 0x06368, 0x00000}, {0x2F8BC, 0x06383, 0x00000},
+  {0x2F8BD, 0x063E4, 0x00000}, {0x2F8BE, 0x22BF1, 0x00000}, {0x2F8BF, 0x06422, 0x00000}, {0x2F8C0, 0x063C5, 0x00000},
+  {0x2F8C1, 0x063A9, 0x00000}, {0x2F8C2, 0x03A2E, 0x00000}, {0x2F8C3, 0x06469, 0x00000}, {0x2F8C4, 0x0647E, 0x00000},
+  {0x2F8C5, 0x0649D, 0x00000}, {0x2F8C6, 0x06477, 0x00000}, {0x2F8C7, 0x03A6C, 0x00000}, {0x2F8C8, 0x0654F, 0x00000},
+  {0x2F8C9, 0x0656C, 0x00000}, {0x2F8CA, 0x2300A, 0x00000}, {0x2F8CB, 0x065E3, 0x00000}, {0x2F8CC, 0x066F8, 0x00000},
+  {0x2F8CD, 0x06649, 0x00000}, {0x2F8CE, 0x03B19, 0x00000}, {0x2F8CF, 0x06691, 0x00000}, {0x2F8D0, 0x03B08, 0x00000},
+  {0x2F8D1, 0x03AE4, 0x00000}, {0x2F8D2, 0x05192, 0x00000}, {0x2F8D3, 0x05195, 0x00000}, {0x2F8D4, 0x06700, 0x00000},
+  {0x2F8D5, 0x0669C, 0x00000}, {0x2F8D6, 0x080AD, 0x00000}, {0x2F8D7, 0x043D9, 0x00000}, {0x2F8D8, 0x06717, 0x00000},
+  {0x2F8D9, 0x0671B, 0x00000}, {0x2F8DA, 0x06721, 0x00000}, {0x2F8DB, 0x0675E, 0x00000}, {0x2F8DC, 0x06753, 0x00000},
+  {0x2F8DD, 0x233C3, 0x00000}, {0x2F8DE, 0x03B49, 0x00000}, {0x2F8DF, 0x067FA, 0x00000}, {0x2F8E0, 0x06785, 0x00000},
+  {0x2F8E1, 0x06852, 0x00000}, {0x2F8E2, 0x06885, 0x00000}, {0x2F8E3, 0x2346D, 0x00000}, {0x2F8E4, 0x0688E, 0x00000},
+  {0x2F8E5, 0x0681F, 0x00000}, {0x2F8E6, 0x06914, 0x00000}, {0x2F8E7, 0x03B9D, 0x00000}, {0x2F8E8, 0x06942, 0x00000},
+  {0x2F8E9, 0x069A3, 0x00000}, {0x2F8EA, 0x069EA, 0x00000}, {0x2F8EB, 0x06AA8, 0x00000}, {0x2F8EC, 0x236A3, 0x00000},
+  {0x2F8ED, 0x06ADB, 0x00000}, {0x2F8EE, 0x03C18, 0x00000}, {0x2F8EF, 0x06B21, 0x00000}, {0x2F8F0, 0x238A7, 0x00000},
+  {0x2F8F1, 0x06B54, 0x00000}, {0x2F8F2, 0x03C4E, 0x00000}, {0x2F8F3, 0x06B72, 0x00000}, {0x2F8F4, 0x06B9F, 0x00000},
+  {0x2F8F5, 0x06BBA, 0x00000}, {0x2F8F6, 0x06BBB, 0x00000}, {0x2F8F7, 0x23A8D, 0x00000}, {0x2F8F8, 0x21D0B, 0x00000},
+  {0x2F8F9, 0x23AFA, 0x00000}, {0x2F8FA, 0x06C4E, 0x00000}, {0x2F8FB, 0x23CBC, 0x00000}, {0x2F8FC, 0x06CBF, 0x00000},
+  {0x2F8FD, 0x06CCD, 0x00000}, {0x2F8FE, 0x06C67, 0x00000}, {0x2F8FF, 0x06D16, 0x00000}, {0x2F900, 0x06D3E, 0x00000},
+  {0x2F901, 0x06D77, 0x00000}, {0x2F902, 0x06D41, 0x00000}, {0x2F903, 0x06D69, 0x00000}, {0x2F904, 0x06D78, 0x00000},
+  {0x2F905, 0x06D85, 0x00000}, {0x2F906, 0x23D1E, 0x00000}, {0x2F907, 0x06D34, 0x00000}, {0x2F908, 0x06E2F, 0x00000},
+  {0x2F909, 0x06E6E, 0x00000}, {0x2F90A, 0x03D33, 0x00000}, {0x2F90B, 0x06ECB, 0x00000}, {0x2F90C, 0x06EC7, 0x00000},
+  {0x2F90D, 0x23ED1, 0x00000}, {0x2F90E, 0x06DF9, 0x00000}, {0x2F90F, 0x06F6E, 0x00000}, {0x2F910, 0x23F5E, 0x00000},
+  {0x2F911, 0x23F8E, 0x00000}, {0x2F912, 0x06FC6, 0x00000}, {0x2F913, 0x07039, 0x00000}, {0x2F914, 0x0701E, 0x00000},
+  {0x2F915, 0x0701B, 0x00000}, {0x2F916, 0x03D96, 0x00000}, {0x2F917, 0x0704A, 0x00000}, {0x2F918, 0x0707D, 0x00000},
+  {0x2F919, 0x07077, 0x00000}, {0x2F91A, 0x070AD, 0x00000}, {0x2F91B, 0x20525, 0x00000}, {0x2F91C, 0x07145, 0x00000},
+  {0x2F91D, 0x24263, 0x00000}, {0x2F91E, 0x0719C, 0x00000}, {0x2F91F, 0x243AB, 0x00000}, {0x2F920, 0x07228, 0x00000},
+  {0x2F921, 0x07235, 0x00000}, {0x2F922, 0x07250, 0x00000}, {0x2F923, 0x24608, 0x00000}, {0x2F924, 0x07280, 0x00000},
+  {0x2F925, 0x07295, 0x00000}, {0x2F926, 0x24735, 0x00000}, {0x2F927, 0x24814, 0x00000}, {0x2F928, 0x0737A, 0x00000},
+  {0x2F929, 0x0738B, 0x00000}, {0x2F92A, 0x03EAC, 0x00000}, {0x2F92B, 0x073A5, 0x00000}, {0x2F92C, 0x03EB8, 0x00000},
+  {0x2F92D, 0x03EB8, 0x00000}, {0x2F92E, 0x07447, 0x00000}, {0x2F92F, 0x0745C, 0x00000}, {0x2F930, 0x07471, 0x00000},
+  {0x2F931, 0x07485, 0x00000}, {0x2F932, 0x074CA, 0x00000}, {0x2F933, 0x03F1B, 0x00000}, {0x2F934, 0x07524, 0x00000},
+  {0x2F935, 0x24C36, 0x00000}, {0x2F936, 0x0753E, 0x00000}, {0x2F937, 0x24C92, 0x00000}, {0x2F938, 0x07570, 0x00000},
+  {0x2F939, 0x2219F, 0x00000}, {0x2F93A, 0x07610, 0x00000}, {0x2F93B, 0x24FA1, 0x00000}, {0x2F93C, 0x24FB8, 0x00000},
+  {0x2F93D, 0x25044, 0x00000}, {0x2F93E, 0x03FFC, 0x00000}, {0x2F93F, 0x04008, 0x00000}, {0x2F940, 0x076F4, 0x00000},
+  {0x2F941, 0x250F3, 0x00000}, {0x2F942, 0x250F2, 0x00000}, {0x2F943, 0x25119, 0x00000}, {0x2F944, 0x25133, 0x00000},
+  {0x2F945, 0x0771E, 0x00000}, {0x2F946, 0x0771F, 0x00000}, {0x2F947, 0x0771F, 0x00000}, {0x2F948, 0x0774A, 0x00000},
+  {0x2F949, 0x04039, 0x00000}, {0x2F94A, 0x0778B, 0x00000}, {0x2F94B, 0x04046, 0x00000}, {0x2F94C, 0x04096, 0x00000},
+  {0x2F94D, 0x2541D, 0x00000}, {0x2F94E, 0x0784E, 0x00000}, {0x2F94F, 0x0788C, 0x00000}, {0x2F950, 0x078CC, 0x00000},
+  {0x2F951, 0x040E3, 0x00000}, {0x2F952, 0x25626, 0x00000}, {0x2F953, 0x07956, 0x00000}, {0x2F954, 0x2569A, 0x00000},
+  {0x2F955, 0x256C5, 0x00000}, {0x2F956, 0x0798F, 0x00000}, {0x2F957, 0x079EB, 0x00000}, {0x2F958, 0x0412F, 0x00000},
+  {0x2F959, 0x07A40, 0x00000}, {0x2F95A, 0x07A4A, 0x00000}, {0x2F95B, 0x07A4F, 0x00000}, {0x2F95C, 0x2597C, 0x00000},
+  {0x2F95D, 0x25AA7, 0x00000}, {0x2F95E, 0x25AA7, 0x00000}, {0x2F95F, 0x07AEE, 0x00000}, {0x2F960, 0x04202, 0x00000},
+  {0x2F961, 0x25BAB, 0x00000}, {0x2F962, 0x07BC6, 0x00000}, {0x2F963, 0x07BC9, 0x00000}, {0x2F964, 0x04227, 0x00000},
+  {0x2F965, 0x25C80, 0x00000}, {0x2F966, 0x07CD2, 0x00000}, {0x2F967, 0x042A0, 0x00000}, {0x2F968, 0x07CE8, 0x00000},
+  {0x2F969, 0x07CE3, 0x00000}, {0x2F96A, 0x07D00, 0x00000}, {0x2F96B, 0x25F86, 0x00000}, {0x2F96C, 0x07D63, 0x00000},
+  {0x2F96D, 0x04301, 0x00000}, {0x2F96E, 0x07DC7, 0x00000}, {0x2F96F, 0x07E02, 0x00000}, {0x2F970, 0x07E45, 0x00000},
+  {0x2F971, 0x04334, 0x00000}, {0x2F972, 0x26228, 0x00000}, {0x2F973, 0x26247, 0x00000}, {0x2F974, 0x04359, 0x00000},
+  {0x2F975, 0x262D9, 0x00000}, {0x2F976, 0x07F7A, 0x00000}, {0x2F977, 0x2633E, 0x00000}, {0x2F978, 0x07F95, 0x00000},
+  {0x2F979, 0x07FFA, 0x00000}, {0x2F97A, 0x08005, 0x00000}, {0x2F97B, 0x264DA, 0x00000}, {0x2F97C, 0x26523, 0x00000},
+  {0x2F97D, 0x08060, 0x00000}, {0x2F97E, 0x265A8, 0x00000}, {0x2F97F, 0x08070, 0x00000}, {0x2F980, 0x2335F, 0x00000},
+  {0x2F981, 0x043D5, 0x00000}, {0x2F982, 0x080B2, 0x00000}, {0x2F983, 0x08103, 0x00000}, {0x2F984, 0x0440B, 0x00000},
+  {0x2F985, 0x0813E, 0x00000}, {0x2F986, 0x05AB5, 0x00000}, {0x2F987, 0x267A7, 0x00000}, {0x2F988, 0x267B5, 0x00000},
+  {0x2F989, 0x23393, 0x00000}, {0x2F98A, 0x2339C, 0x00000}, {0x2F98B, 0x08201, 0x00000}, {0x2F98C, 0x08204, 0x00000},
+  {0x2F98D, 0x08F9E, 0x00000}, {0x2F98E, 0x0446B, 0x00000}, {0x2F98F, 0x08291, 0x00000}, {0x2F990, 0x0828B, 0x00000},
+  {0x2F991, 0x0829D, 0x00000}, {0x2F992, 0x052B3, 0x00000}, {0x2F993, 0x082B1, 0x00000}, {0x2F994, 0x082B3, 0x00000},
+  {0x2F995, 0x082BD, 0x00000}, {0x2F996, 0x082E6, 0x00000}, {0x2F997, 0x26B3C, 0x00000}, {0x2F998, 0x082E5, 0x00000},
+  {0x2F999, 0x0831D, 0x00000}, {0x2F99A, 0x08363, 0x00000}, {0x2F99B, 0x083AD, 0x00000}, {0x2F99C, 0x08323, 0x00000},
+  {0x2F99D, 0x083BD, 0x00000}, {0x2F99E, 0x083E7, 0x00000}, {0x2F99F, 0x08457, 0x00000}, {0x2F9A0, 0x08353, 0x00000},
+  {0x2F9A1, 0x083CA, 0x00000}, {0x2F9A2, 0x083CC, 0x00000}, {0x2F9A3, 0x083DC, 0x00000}, {0x2F9A4, 0x26C36, 0x00000},
+  {0x2F9A5, 0x26D6B, 0x00000}, {0x2F9A6, 0x26CD5, 0x00000}, {0x2F9A7, 0x0452B, 0x00000}, {0x2F9A8, 0x084F1, 0x00000},
+  {0x2F9A9, 0x084F3, 0x00000}, {0x2F9AA, 0x08516, 0x00000}, {0x2F9AB, 0x273CA, 0x00000}, {0x2F9AC, 0x08564, 0x00000},
+  {0x2F9AD, 0x26F2C, 0x00000}, {0x2F9AE, 0x0455D, 0x00000}, {0x2F9AF, 0x04561, 0x00000}, {0x2F9B0, 0x26FB1, 0x00000},
+  {0x2F9B1, 0x270D2, 0x00000}, {0x2F9B2, 0x0456B, 0x00000}, {0x2F9B3, 0x08650, 0x00000}, {0x2F9B4, 0x0865C, 0x00000},
+  {0x2F9B5, 0x08667, 0x00000}, {0x2F9B6, 0x08669, 0x00000}, {0x2F9B7, 0x086A9, 0x00000}, {0x2F9B8, 0x08688, 0x00000},
+  {0x2F9B9, 0x0870E, 0x00000}, {0x2F9BA, 0x086E2, 0x00000}, {0x2F9BB, 0x08779, 0x00000}, {0x2F9BC, 0x08728, 0x00000},
+  {0x2F9BD, 0x0876B, 0x00000}, {0x2F9BE, 0x08786, 0x00000}, {0x2F9BF, 0x045D7, 0x00000}, {0x2F9C0, 0x087E1, 0x00000},
+  {0x2F9C1, 0x08801, 0x00000}, {0x2F9C2, 0x045F9, 0x00000}, {0x2F9C3, 0x08860, 0x00000}, {0x2F9C4, 0x08863, 0x00000},
+  {0x2F9C5, 0x27667, 0x00000}, {0x2F9C6, 0x088D7, 0x00000}, {0x2F9C7, 0x088DE, 0x00000}, {0x2F9C8, 0x04635, 0x00000},
+  {0x2F9C9, 0x088FA, 0x00000}, {0x2F9CA, 0x034BB, 0x00000}, {0x2F9CB, 0x278AE, 0x00000}, {0x2F9CC, 0x27966, 0x00000},
+  {0x2F9CD, 0x046BE, 0x00000}, {0x2F9CE, 0x046C7, 0x00000}, {0x2F9CF, 0x08AA0, 0x00000}, {0x2F9D0, 0x08AED, 0x00000},
+  {0x2F9D1, 0x08B8A, 0x00000}, {0x2F9D2, 0x08C55, 0x00000}, {0x2F9D3, 0x27CA8, 0x00000}, {0x2F9D4, 0x08CAB, 0x00000},
+  {0x2F9D5, 0x08CC1, 0x00000}, {0x2F9D6, 0x08D1B, 0x00000}, {0x2F9D7, 0x08D77, 0x00000}, {0x2F9D8, 0x27F2F, 0x00000},
+  {0x2F9D9, 0x20804, 0x00000}, {0x2F9DA, 0x08DCB, 0x00000}, {0x2F9DB, 0x08DBC, 0x00000}, {0x2F9DC, 0x08DF0, 0x00000},
+  {0x2F9DD, 0x208DE, 0x00000}, {0x2F9DE, 0x08ED4, 0x00000}, {0x2F9DF, 0x08F38, 0x00000}, {0x2F9E0, 0x285D2, 0x00000},
+  {0x2F9E1, 0x285ED, 0x00000}, {0x2F9E2, 0x09094, 0x00000}, {0x2F9E3, 0x090F1, 0x00000}, {0x2F9E4, 0x09111, 0x00000},
+  {0x2F9E5, 0x2872E, 0x00000}, {0x2F9E6, 0x0911B, 0x00000}, {0x2F9E7, 0x09238, 0x00000}, {0x2F9E8, 0x092D7, 0x00000},
+  {0x2F9E9, 0x092D8, 0x00000}, {0x2F9EA, 0x0927C, 0x00000}, {0x2F9EB, 0x093F9, 0x00000}, {0x2F9EC, 0x09415, 0x00000},
+  {0x2F9ED, 0x28BFA, 0x00000}, {0x2F9EE, 0x0958B, 0x00000}, {0x2F9EF, 0x04995, 0x00000}, {0x2F9F0, 0x095B7, 0x00000},
+  {0x2F9F1, 0x28D77, 0x00000}, {0x2F9F2, 0x049E6, 0x00000}, {0x2F9F3, 0x096C3, 0x00000}, {0x2F9F4, 0x05DB2, 0x00000},
+  {0x2F9F5, 0x09723, 0x00000}, {0x2F9F6, 0x29145, 0x00000}, {0x2F9F7, 0x2921A, 0x00000}, {0x2F9F8, 0x04A6E, 0x00000},
+  {0x2F9F9, 0x04A76, 0x00000}, {0x2F9FA, 0x097E0, 0x00000}, {0x2F9FB, 0x2940A, 0x00000}, {0x2F9FC, 0x04AB2, 0x00000},
+  {0x2F9FD, 0x29496, 0x00000}, {0x2F9FE, 0x0980B, 0x00000}, {0x2F9FF, 0x0980B, 0x00000}, {0x2FA00, 0x09829, 0x00000},
+  {0x2FA01, 0x295B6, 0x00000}, {0x2FA02, 0x098E2, 0x00000}, {0x2FA03, 0x04B33, 0x00000}, {0x2FA04, 0x09929, 0x00000},
+  {0x2FA05, 0x099A7, 0x00000}, {0x2FA06, 0x099C2, 0x00000}, {0x2FA07, 0x099FE, 0x00000}, {0x2FA08, 0x04BCE, 0x00000},
+  {0x2FA09, 0x29B30, 0x00000}, {0x2FA0A, 0x09B12, 0x00000}, {0x2FA0B, 0x09C40, 0x00000}, {0x2FA0C, 0x09CFD, 0x00000},
+  {0x2FA0D, 0x04CCE, 0x00000}, {0x2FA0E, 0x04CED, 0x00000}, {0x2FA0F, 0x09D67, 0x00000}, {0x2FA10, 0x2A0CE, 0x00000},
+  {0x2FA11, 0x04CF8, 0x00000}, {0x2FA12, 0x2A105, 0x00000}, {0x2FA13, 0x2A20E, 0x00000}, {0x2FA14, 0x2A291, 0x00000},
+  {0x2FA15, 0x09EBB, 0x00000}, {0x2FA16, 0x04D56, 0x00000}, {0x2FA17, 0x09EF9, 0x00000}, {0x2FA18, 0x09EFE, 0x00000},
+  {0x2FA19, 0x09F05, 0x00000}, {0x2FA1A, 0x09F0F, 0x00000}, {0x2FA1B, 0x09F16, 0x00000}, {0x2FA1C, 0x09F3B, 0x00000},
+  {0x2FA1D, 0x2A600, 0x00000},
+};
+
+// primary composites as indexes in norm_decompositions_, sorted by pair.
+static const uint16_t norm_compositions_[941] = {
+   912,  909,  913,    0,    1,    2,    3,   53,   55,  238,    4,  572,    5,  165,
+   208,  210,  570,  415,   57,  417,  419,  421,   59,   61,   63,   65,    6,  425,
+    67,  427,  431,  433,  429,    7,    8,    9,  598,   69,   71,   73,   10,  596,
+    77,  212,  214,  594,  240,   75,  439,  441,  445,  198,   79,  447,   81,   83,
+   187,   85,   87,  449,  453,  236,  451,  455,  457,   11,   12,   13,   89,   91,
+    93,   97,   14,  610,  167,  216,  218,  612,   95,  459,   98,  463,  189,  465,
+   100,  467,  102,  106,  469,  104,  475,  473,  477,  479,  481,  200,  108,   15,
+   483,  112,  485,  110,  489,  487,   16,   17,   18,   19,  114,  116,  246,   20,
+   616,  118,  169,  220,  222,  161,  614,  191,  499,  501,  120,  503,  124,  224,
+   226,  505,  122,  509,  126,  128,  511,  132,  513,  232,  130,  521,  136,  523,
+   234,  134,  527,  525,   21,   22,   23,  138,  140,  142,   24,  640,  144,  146,
+   171,  228,  230,  163,  638,  529,  148,  533,  531,  539,  541,  543,  545,  150,
+   549,  547,  551,  553,  555,  652,   25,  152,  658,  250,  557,  154,  656,  654,
+   155,  559,  157,  159,  561,  563,   26,   27,   28,   29,   54,   56,  239,   30,
+   573,   31,  166,  209,  211,  571,  416,   58,  418,  420,  422,   60,   62,   64,
+    66,   32,  426,   68,  428,  432,  434,  430,   33,   34,   35,  599,   70,   72,
+    74,   36,  597,   78,  213,  215,  595,  241,   76,  440,  442,  446,  199,   80,
+   448,   82,   84,  188,   86,   88,  450,  454,  237,  452,  456,  458,  565,   37,
+    38,   39,   90,   92,   94,   40,  611,  168,  217,  219,  613,   96,  460,   99,
+   197,  464,  190,  466,  101,  468,  103,  107,  470,  105,  476,  474,  478,  480,
+   482,  201,  109,   41,  484,  113,  486,  111,  490,  488,   42,   43,   44,   45,
+   115,  117,  247,   46,  617,  119,  170,  221,  223,  162,  615,  192,  500,  502,
+   121,  504,  125,  225,  227,  506,  123,  510,  127,  129,  512,  133,  514,  233,
+   131,  522,  566,  137,  524,  235,  135,  528,  526,   47,   48,   49,  139,  141,
+   143,   50,  641,  145,  147,  172,  229,  231,  164,  639,  530,  149,  534,  532,
+   540,  542,  544,  546,  151,  550,  548,  567,  552,  554,  556,  653,   51,  153,
+   659,  251,  558,   52,  657,  568,  655,  156,  560,  158,  160,  562,  564,  875,
+   258,  835,  576,  574,  580,  578,  181,  202,  204,  185,  423,  602,  600,  606,
+   604,  461,  620,  618,  624,  622,  491,  244,  493,  242,  206,  179,  175,  173,
+   177,  577,  575,  581,  579,  182,  203,  205,  186,  424,  603,  601,  607,  605,
+   462,  621,  619,  625,  623,  492,  245,  494,  243,  207,  180,  176,  174,  178,
+   586,  584,  590,  588,  587,  585,  591,  589,  435,  437,  436,  438,  495,  497,
+   496,  498,  515,  516,  517,  518,  535,  536,  537,  538,  569,  630,  628,  634,
+   632,  636,  631,  629,  635,  633,  637,  644,  642,  648,  646,  650,  645,  643,
+   649,  647,  651,  195,  193,  194,  183,  184,  443,  444,  248,  249,  196,  831,
+   259,  830,  829,  668,  669,  833,  841,  261,  682,  683,  843,  262,  696,  697,
+   845,  857,  263,  856,  855,  268,  712,  713,  883,  264,  726,  727,  874,  872,
+   265,  871,  870,  269,  740,  885,  266,  752,  753,  887,  826,  838,  760,  270,
+   823,  822,  660,  661,  827,  825,  762,  271,  676,  677,  764,  272,  688,  689,
+   839,  837,  766,  273,  850,  849,  275,  704,  705,  853,  768,  277,  720,  721,
+   866,  867,  770,  278,  863,  862,  276,  732,  733,  868,  772,  279,  744,  745,
+   881,  879,  851,  267,  854,  864,  274,  869,  880,  280,  281,  285,  302,  304,
+   284,  282,  306,  283,  300,  310,  312,  287,  314,  289,  316,  286,  318,  324,
+   288,  326,  328,  330,  332,  322,  303,  305,  293,  291,  307,  292,  301,  311,
+   313,  296,  315,  290,  317,  295,  319,  325,  297,  327,  329,  331,  333,  323,
+   294,  298,  299,  308,  309,  320,  321,  334,  335,  337,  336,  338,  340,  341,
+   339,  342,  343,  344,  353,  354,  365,  364,  366,  369,  370,  372,  371,  373,
+   374,  377,  375,  376,  378,  379,  381,  380,  382,  383,  385,  384,  403,  404,
+   405,  406,  407,  408,  409,  410,  411,  412,  413,  414,  471,  472,  507,  508,
+   519,  520,  582,  592,  583,  593,  608,  609,  626,  627,  662,  664,  666,  774,
+   663,  665,  667,  775,  776,  777,  778,  779,  780,  781,  670,  672,  674,  782,
+   671,  673,  675,  783,  784,  785,  786,  787,  788,  789,  678,  680,  679,  681,
+   684,  686,  685,  687,  690,  692,  694,  790,  691,  693,  695,  791,  792,  793,
+   794,  795,  796,  797,  698,  700,  702,  798,  699,  701,  703,  799,  800,  801,
+   802,  803,  804,  805,  706,  708,  710,  707,  709,  711,  714,  716,  718,  715,
+   717,  719,  722,  724,  723,  725,  728,  730,  729,  731,  734,  736,  738,  735,
+   737,  739,  741,  742,  743,  746,  748,  750,  806,  747,  749,  751,  807,  808,
+   809,  810,  811,  812,  813,  754,  756,  758,  814,  755,  757,  759,  815,  816,
+   817,  818,  819,  820,  821,  824,  836,  878,  828,  846,  847,  848,  840,  882,
+   859,  860,  861,  894,  895,  896,  897,  899,  898,  900,  901,  902,  903,  904,
+   905,  906,  907,  908,  911,  910,  914,  915,  916,  917,  918,  919,  920,  921,
+   930,  931,  922,  923,  924,  925,  932,  933,  926,  927,  928,  929,  934,  935,
+   936,  937,  966,  941,  942,  943,  944,  945,  946,  947,  948,  949,  950,  951,
+   952,  953,  954,  955,  956,  957,  958,  959,  960,  961,  962,  963,  964,  965,
+   967,  993,  968,  969,  970,  971,  972,  973,  974,  975,  976,  977,  978,  979,
+   980,  981,  982,  983,  984,  985,  986,  987,  988,  989,  990,  991,  992,  994,
+   995,  996,  997,  998, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1501, 1500, 1502,
+  1503, 1504, 1505,
+};
+
+#define NORM_CCC_(p)    ((p) & 0xFF)
+#define NORM_NFC_(p)    (((p) >> 8) & 3)
+#define NORM_NFD_NO_(p) (((p) >> 10) & 1)
+#define NORM_BUFFER_    32
+#define NORM_STREAM_MAX_ 30
+#define NORM_CGJ_       0x034F
+
+#define HANGUL_S_ 0xAC00
+#define HANGUL_L_ 0x1100
+#define HANGUL_V_ 0x1161
+#define HANGUL_T_ 0x11A7
+#define HANGUL_V_COUNT_ 21
+#define HANGUL_T_COUNT_ 28
+#define HANGUL_S_COUNT_ (19 * HANGUL_V_COUNT_ * HANGUL_T_COUNT_)
+
+static unsigned norm_props_(int32_t c) {
+  if (c >= 0x30000) return 0;
+  return norm_values_[norm_stage2_[(norm_stage1_[c >> 5] << 5) | (c & 31)]];
+}
+
+// quick check value of properties for a form
+static enum StrQuickCheck norm_qc_(unsigned props, enum StrNormalForm form) {
+  if (form == STR_NFD) return NORM_NFD_NO_(props) ? STR_QC_NO : STR_QC_YES;
+
+  switch (NORM_NFC_(props)) {
+    case 1:  return STR_QC_NO;
+    case 2:  return STR_QC_MAYBE;
+    default: return STR_QC_YES;
+  }
+}
+
+static const int32_t *norm_decomposition_(int32_t c) {
+  Ssize lo = 0;
+  Ssize hi = sizeof(norm_decompositions_) / sizeof(norm_decompositions_[0]);
+
+  while (lo < hi) {
+    const Ssize mid = lo + (hi - lo) / 2;
+    if (norm_decompositions_[mid][0] < c) lo = mid + 1;
+    else hi = mid;
+  }
+
+  return (norm_decompositions_[lo][0] == c) ? norm_decompositions_[lo] : NULL;
+}
+
+// full canonical decomposition of c, at most 4 codepoints.
+static int norm_decompose_(int32_t c, int32_t *out) {
+  if (c >= HANGUL_S_ && c < HANGUL_S_ + HANGUL_S_COUNT_) {
+    const int32_t s = c - HANGUL_S_;
+    out[0] = HANGUL_L_ + s / (HANGUL_V_COUNT_ * HANGUL_T_COUNT_);
+    out[1] = HANGUL_V_ + (s % (HANGUL_V_COUNT_ * HANGUL_T_COUNT_)) / HANGUL_T_COUNT_;
+    if (s % HANGUL_T_COUNT_ == 0) return 2;
+    out[2] = HANGUL_T_ + s % HANGUL_T_COUNT_;
+    return 3;
+  }
+
+  if (!NORM_NFD_NO_(norm_props_(c))) {
+    out[0] = c;
+    return 1;
+  }
+
+  const int32_t *d = norm_decomposition_(c);
+  int count = norm_decompose_(d[1], out);
+  if (d[2] != 0) count += norm_decompose_(d[2], out + count);
+
+  return count;
+}
+
+// add a canonical decomposition to the run of non starters, true when a CGJ
+// must come first to keep the run within the stream safe limit.
+static bool norm_stream_(int *run, const int32_t *d, int n) {
+  int leading = 0;
+  int trailing = 0;
+  while (leading < n && NORM_CCC_(norm_props_(d[leading])) != 0) leading++;
+  while (trailing < n && NORM_CCC_(norm_props_(d[n - 1 - trailing])) != 0) trailing++;
+
+  const bool cut = *run + leading > NORM_STREAM_MAX_;
+  if (cut) *run = 0;
+  *run = (leading == n) ? *run + n : trailing;
+
+  return cut;
+}
+
+// primary composite of a pair or -1.
+static int32_t norm_compose_(int32_t a, int32_t b) {
+  if (a >= HANGUL_L_ && a < HANGUL_L_ + 19 && b >= HANGUL_V_ && b < HANGUL_V_ + HANGUL_V_COUNT_) {
+    return HANGUL_S_ + ((a - HANGUL_L_) * HANGUL_V_COUNT_ + (b - HANGUL_V_)) * HANGUL_T_COUNT_;
+  }
+  if (a >= HANGUL_S_ && a < HANGUL_S_ + HANGUL_S_COUNT_ && (a - HANGUL_S_) % HANGUL_T_COUNT_ == 0
+      && b > HANGUL_T_ && b < HANGUL_T_ + HANGUL_T_COUNT_) {
+    return a + (b - HANGUL_T_);
+  }
+
+  Ssize lo = 0;
+  Ssize hi = sizeof(norm_compositions_) / sizeof(norm_compositions_[0]);
+  while (lo < hi) {
+    const Ssize mid = lo + (hi - lo) / 2;
+    const int32_t *d = norm_decompositions_[norm_compositions_[mid]];
+    if (d[1] < a || (d[1] == a && d[2] < b)) lo = mid + 1;
+    else hi = mid;
+  }
+  if (lo < (Ssize)(sizeof(norm_compositions_) / sizeof(norm_compositions_[0]))) {
+    const int32_t *d = norm_decompositions_[norm_compositions_[lo]];
+    if (d[1] == a && d[2] == b) return d[0];
+  }
+
+  return -1;
+}
+
+// reorder, compose for NFC and write a buffered segment. same is cleared
+// when the bytes differ from s8 at the same offset.
+static Ssize norm_flush_(int32_t *cps, int *cccs, int count, enum StrNormalForm form,
+                         uint8_t *out, Ssize capacity, Ssize size, UTF8View s8, bool *same) {
+  // canonical ordering, stable on combining classes of non starters
+  for (int j = 1; j < count; ++j) {
+    for (int k = j; k > 0 && cccs[k] != 0 && cccs[k - 1] > cccs[k]; --k) {
+      const int32_t c = cps[k];
+      const int ccc = cccs[k];
+      cps[k] = cps[k - 1];
+      cccs[k] = cccs[k - 1];
+      cps[k - 1] = c;
+      cccs[k - 1] = ccc;
+    }
+  }
+
+  if (form == STR_NFC && count > 0) {
+    int starter = 0;
+    int last_ccc = (cccs[0] == 0) ? 0 : 256;
+    int kept = 1;
+    for (int j = 1; j < count; ++j) {
+      const int32_t composite = norm_compose_(cps[starter], cps[j]);
+      if (composite >= 0 && (last_ccc < cccs[j] || last_ccc == 0)) {
+        cps[starter] = composite;
+        continue;
+      }
+      if (cccs[j] == 0) starter = kept;
+      last_ccc = cccs[j];
+      cps[kept] = cps[j];
+      cccs[kept] = cccs[j];
+      kept++;
+    }
+    count = kept;
+  }
+
+  for (int j = 0; j < count; ++j) {
+    uint8_t bytes[4];
+    const int n = encode_utf8_(cps[j], bytes);
+    *same = *same && size + n <= s8.size && memcmp(s8.data + size, bytes, (Usize)n) == 0;
+    size = escape_put_(out, capacity, size, bytes, n);
+  }
+
+  return size;
+}
+
+// quick check, with stream_safe a run of more than 30 non starters in the
+// canonical decomposition is also a STR_QC_NO at its first codepoint over.
+static enum StrQuickCheck norm_check_(UTF8View s8, enum StrNormalForm form, bool stream_safe, Ssize *offset) {
+  // bytes below limit are ascii or continuation bytes of codepoints with
+  // nothing to check.
+  const uint8_t limit = (form == STR_NFC) ? 0xCC : 0xC3;
+  enum StrQuickCheck result = STR_QC_YES;
+  Ssize first = s8.size;
+  int last_ccc = 0;
+  int nonstarters = 0;
+  Ssize i = 0;
+
+  while (i < s8.size) {
+    const Ssize run = ascii_run_(s8.data + i, s8.size - i, limit);
+    if (run > 0) {
+      i += run;
+      last_ccc = 0;
+      nonstarters = 0;
+
+      // skipped codepoints are starters, only the last one may decompose
+      // with trailing non starters.
+      if (stream_safe && s8.data[i - 1] >= 0x80) {
+        Ssize p = i - 1;
+        while ((s8.data[p] & 0xC0) == 0x80) --p;
+        const UTF8View last = {s8.data + p, i - p};
+        int32_t d[4];
+        norm_stream_(&nonstarters, d, norm_decompose_(UTF8View_get_codepoint(last).codepoint, d));
+      }
+      if (i == s8.size) break;
+    }
+
+    const UTF8View rest = {s8.data + i, s8.size - i};
+    const struct CodeResult cr = UTF8View_get_codepoint(rest);
+    const unsigned props = norm_props_(cr.codepoint);
+    const int ccc = (int)NORM_CCC_(props);
+    enum StrQuickCheck qc = norm_qc_(props, form);
+
+    if (ccc != 0 && last_ccc > ccc) qc = STR_QC_NO;
+    if (stream_safe) {
+      int32_t d[4];
+      if (norm_stream_(&nonstarters, d, norm_decompose_(cr.codepoint, d))) qc = STR_QC_NO;
+    }
+    if (qc != STR_QC_YES && first == s8.size) first = i;
+    if (qc == STR_QC_NO) {
+      result = STR_QC_NO;
+      break;
+    }
+    if (qc == STR_QC_MAYBE) result = STR_QC_MAYBE;
+
+    last_ccc = ccc;
+    i += cr.size;
+  }
+
+  if (offset != NULL) *offset = first;
+
+  return result;
+}
+
+enum StrQuickCheck UTF8View_quick_check(UTF8View s8, enum StrNormalForm form, Ssize *offset) {
+  return norm_check_(s8, form, false, offset);
+}
+
+UTF8View UTF8View_normalize(UTF8View s8, enum StrNormalForm form, uint8_t *out, Ssize capacity) {
+  Ssize offset;
+  if (norm_check_(s8, form, true, &offset) == STR_QC_YES) return s8;
+
+  // back to a starter that nothing before can interact with
+  Ssize start = offset;
+  while (start > 0) {
+    Ssize p = start - 1;
+    while (p > 0 && (s8.data[p] & 0xC0) == 0x80) --p;
+    start = p;
+
+    const UTF8View rest = {s8.data + p, s8.size - p};
+    const unsigned props = norm_props_(UTF8View_get_codepoint(rest).codepoint);
+    if (NORM_CCC_(props) == 0 && norm_qc_(props, form) == STR_QC_YES) break;
+  }
+
+  Ssize size = escape_put_(out, capacity, 0, s8.data, start);
+  bool same = true;
+  int32_t cps[NORM_BUFFER_];
+  int cccs[NORM_BUFFER_];
+  int count = 0;
+  int nonstarters = 0;
+
+  for (Ssize i = start; i < s8.size;) {
+    const UTF8View rest = {s8.data + i, s8.size - i};
+    const struct CodeResult cr = UTF8View_get_codepoint(rest);
+    int32_t d[4];
+    const int n = norm_decompose_(cr.codepoint, d);
+
+    // stream safe: a CGJ, a starter composing with nothing, ends the run
+    if (norm_stream_(&nonstarters, d, n)) {
+      size = norm_flush_(cps, cccs, count, form, out, capacity, size, s8, &same);
+      same = false;
+      cps[0] = NORM_CGJ_;
+      cccs[0] = 0;
+      count = 1;
+    }
+
+    for (int k = 0; k < n; ++k) {
+      const unsigned props = norm_props_(d[k]);
+      const int ccc = (int)NORM_CCC_(props);
+
+      // a segment ends before a starter that cannot compose backward, the
+      // stream safe run keep marks within the buffer, only a long run of
+      // starters composing backward is cut.
+      const bool boundary = ccc == 0 && (form == STR_NFD || NORM_NFC_(props) == 0);
+      if ((boundary && count > 0) || count == NORM_BUFFER_) {
+        size = norm_flush_(cps, cccs, count, form, out, capacity, size, s8, &same);
+        count = 0;
+      }
+      cps[count] = d[k];
+      cccs[count] = ccc;
+      count++;
+    }
+    i += cr.size;
+  }
+  size = norm_flush_(cps, cccs, count, form, out, capacity, size, s8, &same);
+
+  if (same && size == s8.size) return s8;
+  if (size > capacity) {
+    const UTF8View too_small = {NULL, -size};
+    return too_small;
+  }
+
+  const UTF8View normalized = {out, size};
+  return normalized;
+}
+
+//----------------------------------------------------------------------------
+// builder
+//----------------------------------------------------------------------------
+
+#define BUILDER_MIN_CHUNK_ 256
+
+// two digits of all values below 100
+static const char builder_digits_[] =
+  "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+// start a chunk with room for at least size bytes.
+static bool builder_grow_(StrBuilder *b, Ssize size) {
+  if (b->failed) return false;
+
+  Ssize capacity = 2 * b->last->capacity;
+  if (capacity < BUILDER_MIN_CHUNK_) capacity = BUILDER_MIN_CHUNK_;
+  if (capacity < size) capacity = size;
+
+  struct StrBuilderChunk *chunk =
+    (struct StrBuilderChunk*)STR_VIEW_MALLOC(sizeof(struct StrBuilderChunk) + (Usize)capacity);
+  if (chunk == NULL) {
+    b->failed = true;
+    return false;
+  }
+
+  chunk->previous = b->last;
+  chunk->data = (uint8_t*)(chunk + 1);
+  chunk->size = 0;
+  chunk->capacity = capacity;
+  b->last = chunk;
+
+  return true;
+}
+
+void StrBuilder_init(StrBuilder *b, uint8_t *buffer, Ssize capacity) {
+  b->first.previous = NULL;
+  b->first.data = buffer;
+  b->first.size = 0;
+  b->first.capacity = (buffer != NULL) ? capacity : 0;
+  b->last = &b->first;
+  b->total = 0;
+  b->failed = false;
+}
+
+void StrBuilder_free(StrBuilder *b) {
+  struct StrBuilderChunk *chunk = b->last;
+
+  while (chunk != &b->first) {
+    struct StrBuilderChunk *previous = chunk->previous;
+    STR_VIEW_FREE(chunk);
+    chunk = previous;
+  }
+
+  b->last = &b->first;
+  b->first.size = 0;
+  b->total = 0;
+}
+
+void StrBuilder_clear(StrBuilder *b) {
+  struct StrBuilderChunk *last = b->last;
+
+  // the last chunk is the largest one
+  if (last != &b->first && last->capacity > b->first.capacity) {
+    b->last = last->previous;
+    StrBuilder_free(b);
+    last->previous = &b->first;
+    last->size = 0;
+    b->last = last;
+  } else {
+    StrBuilder_free(b);
+  }
+
+  b->failed = false;
+}
+
+Ssize StrBuilder_size(const StrBuilder *b) {
+  return b->total + b->last->size;
+}
+
+bool StrBuilder_reserve(StrBuilder *b, Ssize size) {
+  assert(size >= 0);
+
+  if (b->failed) return false;
+  if (b->last->capacity - b->last->size >= size) return true;
+
+  const Ssize last_size = b->last->size;
+  if (!builder_grow_(b, size)) return false;
+  b->total += last_size;
+
+  return true;
+}
+
+uint8_t *StrBuilder_extend(StrBuilder *b, Ssize size) {
+  assert(size > 0);
+
+  if (!StrBuilder_reserve(b, size)) return NULL;
+
+  uint8_t *bytes = b->last->data + b->last->size;
+  b->last->size += size;
+
+  return bytes;
+}
+
+bool StrBuilder_append(StrBuilder *b, StrView s) {
+  struct StrBuilderChunk *last = b->last;
+
+  if (s.size == 0) return !b->failed;
+
+  // fill the current chunk before starting the next one
+  if (!b->failed && last->capacity - last->size < s.size && last->size < last->capacity) {
+    const Ssize head = last->capacity - last->size;
+    memcpy(last->data + last->size, s.data, (Usize)head);
+    last->size += head;
+    s = StrView_skip(s, head);
+  }
+
+  uint8_t *bytes = StrBuilder_extend(b, s.size);
+  if (bytes == NULL) return false;
+  if (s.size > 0) memcpy(bytes, s.data, (Usize)s.size);
+
+  return true;
+}
+
+bool StrBuilder_append_byte(StrBuilder *b, uint8_t c) {
+  uint8_t *bytes = StrBuilder_extend(b, 1);
+  if (bytes == NULL) return false;
+  bytes[0] = c;
+
+  return true;
+}
+
+bool StrBuilder_append_codepoint(StrBuilder *b, int32_t codepoint) {
+  const bool valid = codepoint >= 0 && codepoint <= 0x10FFFF && (codepoint < 0xD800 || codepoint > 0xDFFF);
+  uint8_t bytes[4];
+  const StrView s = {bytes, encode_utf8_(valid ? codepoint : REPLACEMENT_MARCK, bytes)};
+
+  return StrBuilder_append(b, s) && valid;
+}
+
+bool StrBuilder_append_uint(StrBuilder *b, uint64_t value) {
+  char digits[20];
+  char *p = digits + sizeof(digits);
+
+  while (value >= 100) {
+    const unsigned i = (unsigned)(value % 100) * 2;
+    value /= 100;
+    p -= 2;
+    p[0] = builder_digits_[i];
+    p[1] = builder_digits_[i + 1];
+  }
+  if (value >= 10) {
+    p -= 2;
+    p[0] = builder_digits_[value * 2];
+    p[1] = builder_digits_[value * 2 + 1];
+  } else {
+    *--p = (char)('0' + value);
+  }
+
+  return StrBuilder_append(b, StrView_from_raw(p, digits + sizeof(digits) - p));
+}
+
+bool StrBuilder_append_int(StrBuilder *b, int64_t value) {
+  if (value >= 0) return StrBuilder_append_uint(b, (uint64_t)value);
+
+  return StrBuilder_append_byte(b, '-') && StrBuilder_append_uint(b, 0 - (uint64_t)value);
+}
+
+bool StrBuilder_join(StrBuilder *b, const StrView *views, Ssize count, StrView separator) {
+  if (count <= 0) return !b->failed;
+
+  Ssize size = separator.size * (count - 1);
+  for (Ssize i = 0; i < count; ++i) size += views[i].size;
+  if (size == 0) return !b->failed;
+
+  uint8_t *bytes = StrBuilder_extend(b, size);
+  if (bytes == NULL) return false;
+
+  for (Ssize i = 0; i < count; ++i) {
+    if (i > 0 && separator.size > 0) {
+      memcpy(bytes, separator.data, (Usize)separator.size);
+      bytes += separator.size;
+    }
+    if (views[i].size > 0) {
+      memcpy(bytes, views[i].data, (Usize)views[i].size);
+      bytes += views[i].size;
+    }
+  }
+
+  return true;
+}
+
+Ssize StrBuilder_replace_all(StrBuilder *b, StrView s, StrView match, StrView replacement) {
+  Ssize count = 0;
+
+  // s.size is an upper bound only when replacement is not longer than match,
+  // else let appends grow the builder instead of counting matches twice.
+  if (replacement.size <= match.size && !StrBuilder_reserve(b, s.size)) return -1;
+
+  if (match.size > 0) {
+    for (;;) {
+      const Ssize pos = StrView_find(s, match);
+      if (pos < 0) break;
+      if (!StrBuilder_append(b, StrView_substr(s, 0, pos))) return -1;
+      if (!StrBuilder_append(b, replacement)) return -1;
+      s = StrView_skip(s, pos + match.size);
+      count++;
+    }
+  }
+
+  if (!StrBuilder_append(b, s)) return -1;
+
+  return count;
+}
+
+StrView StrBuilder_view(StrBuilder *b) {
+  if (b->failed) {
+    const StrView failed = {NULL, -1};
+    return failed;
+  }
+
+  if (b->total > 0) {
+    const Ssize size = b->total + b->last->size;
+    struct StrBuilderChunk *chunk = b->last;
+    if (!builder_grow_(b, size)) {
+      const StrView failed = {NULL, -1};
+      return failed;
+    }
+
+    // chunks are linked from the last one, copy them backward
+    struct StrBuilderChunk *merged = b->last;
+    Ssize end = size;
+    for (; chunk != NULL; chunk = chunk->previous) {
+      end -= chunk->size;
+      if (chunk->size > 0) memcpy(merged->data + end, chunk->data, (Usize)chunk->size);
+    }
+
+    b->last = merged->previous;
+    StrBuilder_free(b);
+    merged->previous = &b->first;
+    merged->size = size;
+    b->last = merged;
+  }
+
+  const StrView s = {b->last->data, b->last->size};
+  return s;
+}
+
+//----------------------------------------------------------------------------
+// sorted dictionary
+//----------------------------------------------------------------------------
+
+// layout, all integers of the header and index are native uint64_t:
+//   header: "SVFD" 1 (uint32_t) | key count | keys per block | max key size
+//           | total size
+//   index:  offset of each block
+//   block:  first key size | first key bytes
+//           then for other keys: shared size | suffix size | suffix bytes
+// sizes in blocks are LEB128 varints.
+#define DICT_HEADER_SIZE_ 40
+#define DICT_BLOCK_KEYS_  16
+
+static uint64_t dict_get_(const uint8_t *p) {
+  uint64_t v;
+  memcpy(&v, p, sizeof(v));
+  return v;
+}
+
+static void dict_put_(uint8_t *p, Usize v) {
+  const uint64_t v64 = (uint64_t)v;
+  memcpy(p, &v64, sizeof(v64));
+}
+
+// write v at out + at when out is not NULL, return the offset after it.
+static Usize dict_put_varint_(uint8_t *out, Usize at, Usize v) {
+  for (; v >= 0x80; v >>= 7) {
+    if (out != NULL) out[at] = (uint8_t)(v | 0x80);
+    at++;
+  }
+  if (out != NULL) out[at] = (uint8_t)v;
+
+  return at + 1;
+}
+
+static Ssize dict_varint_(const uint8_t **p) {
+  const uint8_t *q = *p;
+  Usize v = 0;
+  int shift = 0;
+
+  for (; *q >= 0x80; ++q, shift += 7) {
+    v |= (Usize)(*q & 0x7F) << shift;
+  }
+  v |= (Usize)*q << shift;
+  *p = q + 1;
+
+  return (Ssize)v;
+}
+
+// emit blocks of sorted unique keys, only measure when out is NULL.
+// return the offset after the last block.
+static Usize dict_emit_(const StrView *const *keys, Ssize count, uint8_t *out) {
+  const Ssize block_count = (count + DICT_BLOCK_KEYS_ - 1) / DICT_BLOCK_KEYS_;
+  Usize at = DICT_HEADER_SIZE_ + 8 * (Usize)block_count;
+
+  for (Ssize i = 0; i < count; ++i) {
+    const StrView key = *keys[i];
+    Ssize shared = 0;
+
+    if (i % DICT_BLOCK_KEYS_ == 0) {
+      if (out != NULL) dict_put_(out + DICT_HEADER_SIZE_ + 8 * (Usize)(i / DICT_BLOCK_KEYS_), at);
+    } else {
+      shared = prefix_lcp_(*keys[i - 1], key, 0);
+      at = dict_put_varint_(out, at, (Usize)shared);
+    }
+
+    at = dict_put_varint_(out, at, (Usize)(key.size - shared));
+    if (out != NULL && key.size > shared) memcpy(out + at, key.data + shared, (Usize)(key.size - shared));
+    at += (Usize)(key.size - shared);
+  }
+
+  return at;
+}
+
+bool StrDict_build(StrDict *dict, const StrView *keys, Ssize count) {
+  const StrView **sorted = (const StrView**)STR_VIEW_MALLOC(sizeof(StrView*) * (Usize)(count > 0 ? count : 1));
+  if (sorted == NULL) return false;
+
+  for (Ssize i = 0; i < count; ++i) {
+    sorted[i] = &keys[i];
+  }
+  if (count > 0) qsort(sorted, (Usize)count, sizeof(sorted[0]), prefix_compare_);
+
+  Ssize unique = 0;
+  Ssize max_key_size = 0;
+  for (Ssize i = 0; i < count; ++i) {
+    if (unique > 0 && StrView_is_equal(*sorted[unique - 1], *sorted[i])) continue;
+    if (sorted[i]->size > max_key_size) max_key_size = sorted[i]->size;
+    sorted[unique++] = sorted[i];
+  }
+
+  const Usize size = dict_emit_(sorted, unique, NULL);
+  uint8_t *memory = (uint8_t*)STR_VIEW_MALLOC(size);
+  if (memory == NULL) {
+    STR_VIEW_FREE(sorted);
+    return false;
+  }
+
+  const uint32_t version = 1;
+  memcpy(memory, "SVFD", 4);
+  memcpy(memory + 4, &version, 4);
+  dict_put_(memory + 8, (Usize)unique);
+  dict_put_(memory + 16, DICT_BLOCK_KEYS_);
+  dict_put_(memory + 24, (Usize)max_key_size);
+  dict_put_(memory + 32, size);
+  dict_emit_(sorted, unique, memory);
+  STR_VIEW_FREE(sorted);
+
+  dict->bytes = StrView_from_raw(memory, (Ssize)size);
+  dict->count = unique;
+  dict->max_key_size = max_key_size;
+  dict->memory = memory;
+
+  return true;
+}
+
+bool StrDict_from_bytes(StrDict *dict, StrView bytes) {
+  if (bytes.size < DICT_HEADER_SIZE_) return false;
+  if (memcmp(bytes.data, "SVFD", 4) != 0 || prefix_get_(bytes.data + 4) != 1) return false;
+  if (dict_get_(bytes.data + 16) != DICT_BLOCK_KEYS_) return false;
+  if (dict_get_(bytes.data + 32) > (Usize)bytes.size) return false;
+
+  const uint64_t block_count = (dict_get_(bytes.data + 8) + DICT_BLOCK_KEYS_ - 1) / DICT_BLOCK_KEYS_;
+  if (dict_get_(bytes.data + 8) > dict_get_(bytes.data + 32)
+      || DICT_HEADER_SIZE_ + 8 * block_count > dict_get_(bytes.data + 32)) return false;
+
+  dict->bytes = StrView_substr(bytes, 0, (Ssize)dict_get_(bytes.data + 32));
+  dict->count = (Ssize)dict_get_(bytes.data + 8);
+  dict->max_key_size = (Ssize)dict_get_(bytes.data + 24);
+  dict->memory = NULL;
+
+  return true;
+}
+
+StrView StrDict_bytes(const StrDict *dict) {
+  return dict->bytes;
+}
+
+void StrDict_free(StrDict *dict) {
+  STR_VIEW_FREE(dict->memory);
+  dict->memory = NULL;
+  dict->bytes = StrView_from_raw(NULL, 0);
+  dict->count = 0;
+  dict->max_key_size = 0;
+}
+
+static const uint8_t *dict_block_(const StrDict *dict, Ssize block) {
+  return dict->bytes.data + dict_get_(dict->bytes.data + DICT_HEADER_SIZE_ + 8 * (Usize)block);
+}
+
+StrView StrDict_get(const StrDict *dict, Ssize id, uint8_t *out, Ssize capacity) {
+  assert(id >= 0 && id < dict->count);
+
+  const uint8_t *p = dict_block_(dict, id / DICT_BLOCK_KEYS_);
+  Ssize size = 0;
+
+  // bytes past capacity are never shared with a key that fits
+  for (Ssize i = 0; i <= id % DICT_BLOCK_KEYS_; ++i) {
+    const Ssize shared = (i == 0) ? 0 : dict_varint_(&p);
+    const Ssize suffix = dict_varint_(&p);
+    if (shared < capacity) {
+      const Ssize room = capacity - shared;
+      memcpy(out + shared, p, (Usize)(suffix < room ? suffix : room));
+    }
+    p += suffix;
+    size = shared + suffix;
+  }
+
+  if (size > capacity) {
+    const StrView too_small = {NULL, -size};
+    return too_small;
+  }
+
+  const StrView key = {out, size};
+  return key;
+}
+
+// order of a key against a target, keys are cut to the target size when
+// prefix is true. match is the size of their common prefix.
+static int dict_order_(StrView target, Bool prefix, Ssize match, Ssize key_size, uint8_t key_byte) {
+  if (match == target.size) return (prefix || match == key_size) ? 0 : 1;
+  if (match == key_size) return -1;
+
+  return (key_byte < target.data[match]) ? -1 : 1;
+}
 
-#include <assert.h>
-#include <string.h>
-#include <ctype.h>
+// id of the first key whose order against target is at least threshold,
+// count if none. order receive the order of this key.
+static Ssize dict_search_(const StrDict *dict, StrView target, Bool prefix, int threshold, int *order) {
+  const Ssize block_count = (dict->count + DICT_BLOCK_KEYS_ - 1) / DICT_BLOCK_KEYS_;
 
-static struct CodeResult decode_lead_(uint8_t lead) {
-  struct CodeResult cr;
+  // number of blocks whose first key is before the answer
+  Ssize lo = 0;
+  Ssize hi = block_count;
+  while (lo < hi) {
+    const Ssize mid = lo + (hi - lo) / 2;
+    const uint8_t *p = dict_block_(dict, mid);
+    const Ssize size = dict_varint_(&p);
+    const Ssize match = prefix_lcp_(StrView_from_raw(p, size), target, 0);
+    const uint8_t byte = (match < size) ? p[match] : 0;
 
-  if (lead <= 0x7F) {
-    cr.codepoint = lead;
-    cr.size = 1;
-  } else if ((lead & 0xE0) == 0xC0) {
-    cr.codepoint = (lead & 0x1F);
-    cr.size = 2;
-  } else if ((lead & 0xF0) == 0xE0) {
-    cr.codepoint = (lead & 0x0F);
-    cr.size = 3;
-  } else if ((lead & 0xF8) == 0xF0) {
-    cr.codepoint = (lead & 0x07);
-    cr.size = 4;
-  } else if ((lead & 0xFC) == 0xF8) {
-    cr.codepoint = (lead & 0x03);
-    cr.size = 5;
-  } else if ((lead & 0xFE) == 0xFC) {
-    cr.codepoint = (lead & 0x01);
-    cr.size = 6;
-  } else {
-    cr.codepoint = lead; 
-    cr.size = 1;
+    if (dict_order_(target, prefix, match, size, byte) < threshold) lo = mid + 1;
+    else hi = mid;
   }
 
-  return cr;
+  // scan keeping the common prefix of each key with target, keys are never
+  // decoded. blocks are contiguous, the scan stops at most at the first key
+  // of the next block.
+  const Ssize start = (lo > 0) ? (lo - 1) * DICT_BLOCK_KEYS_ : 0;
+  const uint8_t *p = (dict->count > 0) ? dict_block_(dict, start / DICT_BLOCK_KEYS_) : NULL;
+  Ssize match = 0;
+  *order = 1;
+
+  for (Ssize id = start; id < dict->count; ++id) {
+    const bool first = id % DICT_BLOCK_KEYS_ == 0;
+    const Ssize shared = first ? 0 : dict_varint_(&p);
+    const Ssize suffix = dict_varint_(&p);
+
+    if (first || shared == match) {
+      match = shared + prefix_lcp_(StrView_from_raw(p, suffix), StrView_skip(target, shared), 0);
+      const uint8_t byte = (match - shared < suffix) ? p[match - shared] : 0;
+      *order = dict_order_(target, prefix, match, shared + suffix, byte);
+    } else if (shared < match) {
+      // the key differs from the previous one before target does
+      match = shared;
+      *order = 1;
+    }
+    p += suffix;
+
+    if (*order >= threshold) return id;
+  }
+
+  *order = 1;
+  return dict->count;
 }
 
-static struct CodeResult decode_tail_(CodeResult cr, StrView s) {
-  static const struct {
-    int size;
-    struct {
-      int32_t min, max;
-    } codepoint_ranges;
-    struct {
-      uint8_t min, max;
-    } bytes_ranges[4];
-  } tbl[] = {
-      {1, {0x000000, 0x00007F}, {{0x00, 0x7F}}},
-      {2, {0x000080, 0x0007FF}, {{0xC2, 0xDF}, {0x80, 0xBF}}},
-      {3, {0x000800, 0x000FFF}, {{0xE0, 0xE0}, {0xA0, 0xBF}, {0x80, 0xBF}}},
-      {3, {0x001000, 0x00FFFF}, {{0xE1, 0xEF}, {0x80, 0xBF}, {0x80, 0xBF}}},
-      {4, {0x010000, 0x03FFFF}, {{0xF0, 0xF0}, {0x90, 0xBF}, {0x80, 0xBF}, {0x80, 0xBF}}},
-      {4, {0x040000, 0x0FFFFF}, {{0xF1, 0xF3}, {0x80, 0xBF}, {0x80, 0xBF}, {0x80, 0xBF}}},
-      {4, {0x100000, 0x10FFFF}, {{0xF4, 0xF4}, {0x80, 0x8F}, {0x80, 0xBF}, {0x80, 0xBF}}}
-    };
+Ssize StrDict_find(const StrDict *dict, StrView key) {
+  int order;
+  const Ssize id = dict_search_(dict, key, false, 0, &order);
 
-  if (cr.size > s.size) {
-    cr.codepoint = CODEPOINT_INVALID;
-    cr.size = s.size;
+  return (order == 0) ? id : -1;
+}
 
-    return cr;
+Ssize StrDict_lower_bound(const StrDict *dict, StrView key) {
+  int order;
+
+  return dict_search_(dict, key, false, 0, &order);
+}
+
+Ssize StrDict_prefix_range(const StrDict *dict, StrView prefix, Ssize *first) {
+  int order;
+  const Ssize lo = dict_search_(dict, prefix, true, 0, &order);
+  const Ssize hi = (order == 0) ? dict_search_(dict, prefix, true, 1, &order) : lo;
+
+  if (first != NULL) *first = lo;
+
+  return hi - lo;
+}
+
+//----------------------------------------------------------------------------
+// line reader
+//----------------------------------------------------------------------------
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <errno.h>
+#include <unistd.h>
+
+#define LINE_DEFAULT_CAPACITY_ (64 * 1024)
+
+bool StrLineReader_init(StrLineReader *reader, int fd, Ssize capacity, int flags) {
+  if (capacity <= 0) capacity = LINE_DEFAULT_CAPACITY_;
+
+  reader->buffer = (uint8_t*)STR_VIEW_MALLOC((Usize)capacity);
+  if (reader->buffer == NULL) return false;
+
+  reader->fd = fd;
+  reader->flags = flags;
+  reader->error = 0;
+  reader->eof = false;
+  reader->capacity = capacity;
+  reader->pos = 0;
+  reader->end = 0;
+  reader->next = 0;
+  reader->mask = 0;
+
+  return true;
+}
+
+void StrLineReader_free(StrLineReader *reader) {
+  STR_VIEW_FREE(reader->buffer);
+  reader->buffer = NULL;
+  reader->capacity = 0;
+  reader->pos = 0;
+  reader->end = 0;
+  reader->next = 0;
+  reader->mask = 0;
+}
+
+// offset of the next newline in the buffer or -1. newlines of the 64 bytes
+// before reader->next are kept in reader->mask.
+static Ssize line_find_(StrLineReader *reader) {
+  for (;;) {
+    if (reader->mask != 0) {
+      const Ssize i = reader->next - 64 + ctz64_(reader->mask);
+      reader->mask &= reader->mask - 1;
+      return i;
+    }
+
+    const Ssize at = reader->next;
+    if (at + 64 <= reader->end) {
+      reader->mask = eq_mask64_(reader->buffer + at, '\n');
+      reader->next = at + 64;
+      continue;
+    }
+
+    const uint8_t *hit = (const uint8_t*)memchr(reader->buffer + at, '\n', (Usize)(reader->end - at));
+    if (hit == NULL) return -1;
+    reader->next = hit - reader->buffer + 1;
+    return reader->next - 1;
   }
+}
 
-  // make sure tail has all continuation bytes.
-  for (int i = 1; i < cr.size; ++i) {
-    if ((s.data[i] & 0xC0) != 0x80) {
-      cr.codepoint = CODEPOINT_INVALID;
-      cr.size = i;
+// move the unfinished line to the start of the buffer and read after it.
+static bool line_fill_(StrLineReader *reader) {
+  if (reader->pos > 0) {
+    const Ssize rest = reader->end - reader->pos;
+    if (rest > 0) memmove(reader->buffer, reader->buffer + reader->pos, (Usize)rest);
+    reader->next -= reader->pos;
+    reader->end = rest;
+    reader->pos = 0;
+  }
 
-      return cr;
+  if (reader->end == reader->capacity) {
+    uint8_t *buffer = (uint8_t*)STR_VIEW_MALLOC(2 * (Usize)reader->capacity);
+    if (buffer == NULL) {
+      reader->error = ENOMEM;
+      return false;
     }
+    memcpy(buffer, reader->buffer, (Usize)reader->end);
+    STR_VIEW_FREE(reader->buffer);
+    reader->buffer = buffer;
+    reader->capacity *= 2;
   }
 
-  // updating codepoint value
-  for (int i = 1; i < cr.size; ++i) {
-    cr.codepoint = (cr.codepoint << 6) | (s.data[i] & 0x3F);
+  ssize_t count;
+  do {
+    count = read(reader->fd, reader->buffer + reader->end, (Usize)(reader->capacity - reader->end));
+  } while (count < 0 && errno == EINTR);
+
+  if (count < 0) {
+    reader->error = errno;
+    return false;
   }
-  
-  // check ranges
-  bool is_valid = false;
-  for (int i = 0; i != (sizeof(tbl) / sizeof(tbl[0])); ++i) {
-    if (cr.size == tbl[i].size) {
-      const int32_t c_min = tbl[i].codepoint_ranges.min;
-      const int32_t c_max = tbl[i].codepoint_ranges.max;
-      if (cr.codepoint >= c_min && cr.codepoint <= c_max) {
-        is_valid = true;
-        for (int b = 0; b < tbl[i].size; ++b) {
-          const uint8_t b_min = tbl[i].bytes_ranges[b].min;
-          const uint8_t b_max = tbl[i].bytes_ranges[b].max;
-          const uint8_t value = s.data[b];
-          is_valid = is_valid && value >= b_min && value <= b_max;
-        }
-        break;
+  if (count == 0) reader->eof = true;
+  reader->end += count;
+
+  return true;
+}
+
+bool StrLineReader_next(StrLineReader *reader, StrView *line) {
+  Ssize newline;
+
+  reader->error = 0;
+  for (;;) {
+    newline = line_find_(reader);
+    if (newline >= 0) break;
+
+    if (reader->eof) {
+      if (reader->pos == reader->end) return false;
+      newline = reader->end;
+      break;
+    }
+    if (!line_fill_(reader)) return false;
+  }
+
+  line->data = reader->buffer + reader->pos;
+  line->size = newline - reader->pos;
+  reader->pos = (newline < reader->end) ? newline + 1 : newline;
+  if (reader->next < reader->pos) {
+    reader->next = reader->pos;
+    reader->mask = 0;
+  }
+
+  if ((reader->flags & STR_LINE_CRLF) && newline < reader->end
+      && line->size > 0 && line->data[line->size - 1] == '\r') {
+    line->size--;
+  }
+
+  if (reader->flags & STR_LINE_UTF8) {
+    // ascii lines are checked 16 or 32 bytes at a time
+    const Ssize ascii = ascii_run_(line->data, line->size, 0x80);
+    if (ascii < line->size && !StrView_is_valid_utf8(StrView_skip(*line, ascii))) {
+      reader->error = EILSEQ;
+    }
+  }
+
+  return true;
+}
+
+#endif
+
+//----------------------------------------------------------------------------
+// trigram index
+//----------------------------------------------------------------------------
+
+// layout, all integers are native:
+//   header:   "SVTG" 1 (uint32_t) | doc count | trigram count | total size
+//             (uint64_t)
+//   keys:     sorted trigrams as uint32_t, padded to 8 bytes
+//   offsets:  uint64_t offset of each posting list and of the end
+//   postings: first id then deltas to the previous id as LEB128 varints
+#define TRIGRAM_HEADER_SIZE_ 32
+#define TRIGRAM_QUERY_MAX_   8
+
+static uint32_t trigram_at_(const uint8_t *p) {
+  return (uint32_t)p[0] << 16 | (uint32_t)p[1] << 8 | p[2];
+}
+
+static Usize trigram_offsets_(Ssize trigram_count) {
+  return TRIGRAM_HEADER_SIZE_ + (((Usize)trigram_count * 4 + 7) & ~(Usize)7);
+}
+
+// emit keys, offsets and postings of sorted (trigram << 32 | id) pairs,
+// only measure when out is NULL. return the total size.
+static Usize trigram_emit_(const uint64_t *pairs, Usize count, Ssize trigram_count, uint8_t *out) {
+  const Usize offsets = trigram_offsets_(trigram_count);
+  Usize at = offsets + 8 * (Usize)(trigram_count + 1);
+  Ssize k = 0;
+  uint64_t previous = 0;
+
+  for (Usize i = 0; i < count; ++i) {
+    const uint64_t pair = pairs[i];
+    if (i > 0 && pair == pairs[i - 1]) continue;
+
+    if (i == 0 || (pair >> 32) != (pairs[i - 1] >> 32)) {
+      if (out != NULL) {
+        prefix_put_(out + TRIGRAM_HEADER_SIZE_ + 4 * (Usize)k, (Usize)(pair >> 32));
+        dict_put_(out + offsets + 8 * (Usize)k, at);
       }
+      k++;
+      previous = 0;
+    }
+    at = dict_put_varint_(out, at, (Usize)((pair & UINT32_MAX) - previous));
+    previous = pair & UINT32_MAX;
+  }
+  if (out != NULL) dict_put_(out + offsets + 8 * (Usize)k, at);
+
+  return at;
+}
+
+bool StrTrigramIndex_build(StrTrigramIndex *index, const StrView *docs, Ssize count) {
+  if ((uint64_t)count > UINT32_MAX) return false;
+
+  Usize pair_count = 0;
+  for (Ssize i = 0; i < count; ++i) {
+    if (docs[i].size > 2) pair_count += (Usize)docs[i].size - 2;
+  }
+
+  uint64_t *memory_pairs = (uint64_t*)STR_VIEW_MALLOC(2 * sizeof(uint64_t) * (pair_count > 0 ? pair_count : 1));
+  if (memory_pairs == NULL) return false;
+  uint64_t *pairs = memory_pairs;
+  uint64_t *sorted = pairs + pair_count;
+
+  Usize n = 0;
+  for (Ssize i = 0; i < count; ++i) {
+    for (Ssize j = 0; j + 2 < docs[i].size; ++j) {
+      pairs[n++] = (uint64_t)trigram_at_(docs[i].data + j) << 32 | (uint64_t)i;
+    }
+  }
+
+  // ids are generated in order, a stable radix sort on the 3 trigram bytes
+  // keeps them sorted within each trigram.
+  for (int shift = 32; shift < 56; shift += 8) {
+    Usize counts[257] = {0};
+    for (Usize i = 0; i < n; ++i) counts[((pairs[i] >> shift) & 0xFF) + 1]++;
+    for (int b = 0; b < 256; ++b) counts[b + 1] += counts[b];
+    for (Usize i = 0; i < n; ++i) sorted[counts[(pairs[i] >> shift) & 0xFF]++] = pairs[i];
+
+    uint64_t *swap = pairs;
+    pairs = sorted;
+    sorted = swap;
+  }
+
+  Ssize trigram_count = 0;
+  for (Usize i = 0; i < n; ++i) {
+    if (i == 0 || (pairs[i] >> 32) != (pairs[i - 1] >> 32)) trigram_count++;
+  }
+
+  const Usize size = trigram_emit_(pairs, n, trigram_count, NULL);
+  uint8_t *memory = (uint8_t*)STR_VIEW_MALLOC(size);
+  if (memory == NULL) {
+    STR_VIEW_FREE(memory_pairs);
+    return false;
+  }
+
+  memset(memory, 0, trigram_offsets_(trigram_count));
+  memcpy(memory, "SVTG", 4);
+  prefix_put_(memory + 4, 1);
+  dict_put_(memory + 8, (Usize)count);
+  dict_put_(memory + 16, (Usize)trigram_count);
+  dict_put_(memory + 24, size);
+  trigram_emit_(pairs, n, trigram_count, memory);
+  STR_VIEW_FREE(memory_pairs);
+
+  index->bytes = StrView_from_raw(memory, (Ssize)size);
+  index->doc_count = count;
+  index->trigram_count = trigram_count;
+  index->memory = memory;
+
+  return true;
+}
+
+bool StrTrigramIndex_from_bytes(StrTrigramIndex *index, StrView bytes) {
+  if (bytes.size < TRIGRAM_HEADER_SIZE_) return false;
+  if (memcmp(bytes.data, "SVTG", 4) != 0 || prefix_get_(bytes.data + 4) != 1) return false;
+
+  const uint64_t size = dict_get_(bytes.data + 24);
+  const uint64_t trigram_count = dict_get_(bytes.data + 16);
+  if (size > (Usize)bytes.size || trigram_count > size) return false;
+  if (trigram_offsets_((Ssize)trigram_count) + 8 * (trigram_count + 1) > size) return false;
+
+  index->bytes = StrView_substr(bytes, 0, (Ssize)size);
+  index->doc_count = (Ssize)dict_get_(bytes.data + 8);
+  index->trigram_count = (Ssize)trigram_count;
+  index->memory = NULL;
+
+  return true;
+}
+
+StrView StrTrigramIndex_bytes(const StrTrigramIndex *index) {
+  return index->bytes;
+}
+
+void StrTrigramIndex_free(StrTrigramIndex *index) {
+  STR_VIEW_FREE(index->memory);
+  index->memory = NULL;
+  index->bytes = StrView_from_raw(NULL, 0);
+  index->doc_count = 0;
+  index->trigram_count = 0;
+}
+
+// decoding position in a posting list.
+struct TrigramCursor_ {
+  const uint8_t *p;
+  const uint8_t *end;
+  Ssize id;
+};
+
+// find the posting list of a trigram, false if absent.
+static bool trigram_postings_(const StrTrigramIndex *index, uint32_t trigram, struct TrigramCursor_ *cursor) {
+  const uint8_t *base = index->bytes.data;
+  Ssize lo = 0;
+  Ssize hi = index->trigram_count;
+
+  while (lo < hi) {
+    const Ssize mid = lo + (hi - lo) / 2;
+    if (prefix_get_(base + TRIGRAM_HEADER_SIZE_ + 4 * (Usize)mid) < trigram) lo = mid + 1;
+    else hi = mid;
+  }
+  if (lo == index->trigram_count || prefix_get_(base + TRIGRAM_HEADER_SIZE_ + 4 * (Usize)lo) != trigram) return false;
+
+  const uint8_t *offsets = base + trigram_offsets_(index->trigram_count) + 8 * (Usize)lo;
+  cursor->p = base + dict_get_(offsets);
+  cursor->end = base + dict_get_(offsets + 8);
+  cursor->id = -1;
+
+  return true;
+}
+
+// move a cursor to its first id >= id, false at the end of the list.
+static bool trigram_seek_(struct TrigramCursor_ *cursor, Ssize id) {
+  while (cursor->id < id) {
+    if (cursor->p == cursor->end) return false;
+    cursor->id = (cursor->id < 0) ? dict_varint_(&cursor->p) : cursor->id + dict_varint_(&cursor->p);
+  }
+
+  return true;
+}
+
+struct TrigramResult_ {
+  const StrView *docs;
+  StrView needle;
+  Ssize *ids;
+  Ssize capacity;
+  Ssize count;
+};
+
+// keep a candidate, checked against its document when docs are given.
+static void trigram_add_(struct TrigramResult_ *result, Ssize id) {
+  if (result->docs == NULL || StrView_contains(result->docs[id], result->needle)) {
+    if (result->count < result->capacity) result->ids[result->count] = id;
+    result->count++;
+  }
+}
+
+static Ssize trigram_intersect_(const StrTrigramIndex *index, struct TrigramResult_ *result) {
+  const StrView needle = result->needle;
+
+  if (needle.size < 3) {
+    for (Ssize id = 0; id < index->doc_count; ++id) trigram_add_(result, id);
+    return result->count;
+  }
+
+  // keep the rarest trigrams, ordered by posting list size
+  struct TrigramCursor_ cursors[TRIGRAM_QUERY_MAX_];
+  int count = 0;
+  for (Ssize i = 0; i + 2 < needle.size; ++i) {
+    struct TrigramCursor_ cursor;
+    if (!trigram_postings_(index, trigram_at_(needle.data + i), &cursor)) return 0;
+
+    bool seen = false;
+    for (int k = 0; k < count; ++k) seen = seen || cursors[k].p == cursor.p;
+    if (seen) continue;
+
+    int k = (count < TRIGRAM_QUERY_MAX_) ? count++ : TRIGRAM_QUERY_MAX_;
+    for (; k > 0 && cursors[k - 1].end - cursors[k - 1].p > cursor.end - cursor.p; --k) {
+      if (k < TRIGRAM_QUERY_MAX_) cursors[k] = cursors[k - 1];
+    }
+    if (k < TRIGRAM_QUERY_MAX_) cursors[k] = cursor;
+  }
+
+  // the rarest list leads, others are moved to its ids
+  Ssize id = 0;
+  for (;;) {
+    if (!trigram_seek_(&cursors[0], id)) break;
+    id = cursors[0].id;
+
+    int k = 1;
+    while (k < count && trigram_seek_(&cursors[k], id) && cursors[k].id == id) ++k;
+
+    if (k == count) {
+      trigram_add_(result, id);
+      id++;
+    } else if (cursors[k].id > id) {
+      id = cursors[k].id;
+    } else {
+      break;
+    }
+  }
+
+  return result->count;
+}
+
+Ssize StrTrigramIndex_candidates(const StrTrigramIndex *index, StrView needle, Ssize *ids, Ssize capacity) {
+  struct TrigramResult_ result = {NULL, needle, ids, capacity, 0};
+
+  return trigram_intersect_(index, &result);
+}
+
+Ssize StrTrigramIndex_search(const StrTrigramIndex *index, const StrView *docs, StrView needle,
+                             Ssize *ids, Ssize capacity) {
+  struct TrigramResult_ result = {docs, needle, ids, capacity, 0};
+
+  return trigram_intersect_(index, &result);
+}
+
+//----------------------------------------------------------------------------
+// case mapping
+//----------------------------------------------------------------------------
+
+#define CASE_SPECIAL_ 0x200000
+#define CASE_LIMIT_   0x1E980
+
+// tables generated from Unicode 14.0.0 data (python unicodedata).
+// {lower, upper} full case mappings as a delta to the codepoint or
+// CASE_SPECIAL_ + index in case_specials_ for mappings to many codepoints,
+// two level lookup of 64 codepoints blocks up to U+1E980.
+static const int32_t case_values_[276][2] = {
+  {0, 0}, {-42319, 0}, {-42315, 0}, {-42308, 0},
+  {-42307, 0}, {-42305, 0}, {-42282, 0}, {-42280, 0},
+  {-42261, 0}, {-42258, 0}, {-35384, 0}, {-35332, 0},
+  {-10815, 0}, {-10783, 0}, {-10782, 0}, {-10780, 0},
+  {-10749, 0}, {-10743, 0}, {-10727, 0}, {-8383, 0},
+  {-8262, 0}, {-7615, 0}, {-7517, 0}, {-3814, 0},
+  {-3008, 0}, {-195, 0}, {-163, 0}, {-130, 0},
+  {-128, 0}, {-126, 0}, {-121, 0}, {-112, 0},
+  {-100, 0}, {-97, 0}, {-86, 0}, {-74, 0},
+  {-60, 0}, {-56, 0}, {-48, 0}, {-9, CASE_SPECIAL_ + 41},
+  {-9, CASE_SPECIAL_ + 46}, {-9, CASE_SPECIAL_ + 58}, {-8, 0}, {-8, CASE_SPECIAL_ + 16},
+  {-8, CASE_SPECIAL_ + 17}, {-8, CASE_SPECIAL_ + 18}, {-8, CASE_SPECIAL_ + 19}, {-8, CASE_SPECIAL_ + 20},
+  {-8, CASE_SPECIAL_ + 21}, {-8, CASE_SPECIAL_ + 22}, {-8, CASE_SPECIAL_ + 23}, {-8, CASE_SPECIAL_ + 24},
+  {-8, CASE_SPECIAL_ + 25}, {-8, CASE_SPECIAL_ + 26}, {-8, CASE_SPECIAL_ + 27}, {-8, CASE_SPECIAL_ + 28},
+  {-8, CASE_SPECIAL_ + 29}, {-8, CASE_SPECIAL_ + 30}, {-8, CASE_SPECIAL_ + 31}, {-8, CASE_SPECIAL_ + 32},
+  {-8, CASE_SPECIAL_ + 33}, {-8, CASE_SPECIAL_ + 34}, {-8, CASE_SPECIAL_ + 35}, {-8, CASE_SPECIAL_ + 36},
+  {-8, CASE_SPECIAL_ + 37}, {-8, CASE_SPECIAL_ + 38}, {-8, CASE_SPECIAL_ + 39}, {-7, 0},
+  {0, -38864}, {0, -10795}, {0, -10792}, {0, -7264},
+  {0, -7205}, {0, -6254}, {0, -6253}, {0, -6244},
+  {0, -6243}, {0, -6242}, {0, -6236}, {0, -6181},
+  {0, -928}, {0, -300}, {0, -232}, {0, -219},
+  {0, -218}, {0, -217}, {0, -214}, {0, -213},
+  {0, -211}, {0, -210}, {0, -209}, {0, -207},
+  {0, -206}, {0, -205}, {0, -203}, {0, -202},
+  {0, -116}, {0, -96}, {0, -86}, {0, -80},
+  {0, -79}, {0, -71}, {0, -69}, {0, -64},
+  {0, -63}, {0, -62}, {0, -59}, {0, -57},
+  {0, -54}, {0, -48}, {0, -47}, {0, -40},
+  {0, -39}, {0, -38}, {0, -37}, {0, -34},
+  {0, -32}, {0, -31}, {0, -28}, {0, -26},
+  {0, -16}, {0, -15}, {0, -8}, {0, -2},
+  {0, -1}, {0, 7}, {0, 8}, {0, 48},
+  {0, 56}, {0, 74}, {0, 84}, {0, 86},
+  {0, 97}, {0, 100}, {0, 112}, {0, 121},
+  {0, 126}, {0, 128}, {0, 130}, {0, 163},
+  {0, 195}, {0, 743}, {0, 3008}, {0, 3814},
+  {0, 10727}, {0, 10743}, {0, 10749}, {0, 10780},
+  {0, 10782}, {0, 10783}, {0, 10815}, {0, 35266},
+  {0, 35332}, {0, 35384}, {0, 42258}, {0, 42261},
+  {0, 42280}, {0, 42282}, {0, 42305}, {0, 42307},
+  {0, 42308}, {0, 42315}, {0, 42319}, {0, CASE_SPECIAL_ + 0},
+  {0, CASE_SPECIAL_ + 2}, {0, CASE_SPECIAL_ + 3}, {0, CASE_SPECIAL_ + 4}, {0, CASE_SPECIAL_ + 5},
+  {0, CASE_SPECIAL_ + 6}, {0, CASE_SPECIAL_ + 7}, {0, CASE_SPECIAL_ + 8}, {0, CASE_SPECIAL_ + 9},
+  {0, CASE_SPECIAL_ + 10}, {0, CASE_SPECIAL_ + 11}, {0, CASE_SPECIAL_ + 12}, {0, CASE_SPECIAL_ + 13},
+  {0, CASE_SPECIAL_ + 14}, {0, CASE_SPECIAL_ + 15}, {0, CASE_SPECIAL_ + 16}, {0, CASE_SPECIAL_ + 17},
+  {0, CASE_SPECIAL_ + 18}, {0, CASE_SPECIAL_ + 19}, {0, CASE_SPECIAL_ + 20}, {0, CASE_SPECIAL_ + 21},
+  {0, CASE_SPECIAL_ + 22}, {0, CASE_SPECIAL_ + 23}, {0, CASE_SPECIAL_ + 24}, {0, CASE_SPECIAL_ + 25},
+  {0, CASE_SPECIAL_ + 26}, {0, CASE_SPECIAL_ + 27}, {0, CASE_SPECIAL_ + 28}, {0, CASE_SPECIAL_ + 29},
+  {0, CASE_SPECIAL_ + 30}, {0, CASE_SPECIAL_ + 31}, {0, CASE_SPECIAL_ + 32}, {0, CASE_SPECIAL_ + 33},
+  {0, CASE_SPECIAL_ + 34}, {0, CASE_SPECIAL_ + 35}, {0, CASE_SPECIAL_ + 36}, {0, CASE_SPECIAL_ + 37},
+  {0, CASE_SPECIAL_ + 38}, {0, CASE_SPECIAL_ + 39}, {0, CASE_SPECIAL_ + 40}, {0, CASE_SPECIAL_ + 41},
+  {0, CASE_SPECIAL_ + 42}, {0, CASE_SPECIAL_ + 43}, {0, CASE_SPECIAL_ + 44}, {0, CASE_SPECIAL_ + 45},
+  {0, CASE_SPECIAL_ + 46}, {0, CASE_SPECIAL_ + 47}, {0, CASE_SPECIAL_ + 48}, {0, CASE_SPECIAL_ + 49},
+  {0, CASE_SPECIAL_ + 50}, {0, CASE_SPECIAL_ + 51}, {0, CASE_SPECIAL_ + 52}, {0, CASE_SPECIAL_ + 53},
+  {0, CASE_SPECIAL_ + 54}, {0, CASE_SPECIAL_ + 55}, {0, CASE_SPECIAL_ + 56}, {0, CASE_SPECIAL_ + 57},
+  {0, CASE_SPECIAL_ + 58}, {0, CASE_SPECIAL_ + 59}, {0, CASE_SPECIAL_ + 60}, {0, CASE_SPECIAL_ + 61},
+  {0, CASE_SPECIAL_ + 62}, {0, CASE_SPECIAL_ + 63}, {0, CASE_SPECIAL_ + 64}, {0, CASE_SPECIAL_ + 65},
+  {0, CASE_SPECIAL_ + 66}, {0, CASE_SPECIAL_ + 67}, {0, CASE_SPECIAL_ + 68}, {0, CASE_SPECIAL_ + 69},
+  {0, CASE_SPECIAL_ + 70}, {0, CASE_SPECIAL_ + 71}, {0, CASE_SPECIAL_ + 72}, {1, -1},
+  {1, 0}, {2, 0}, {8, 0}, {15, 0},
+  {16, 0}, {26, 0}, {28, 0}, {32, 0},
+  {34, 0}, {37, 0}, {38, 0}, {39, 0},
+  {40, 0}, {48, 0}, {63, 0}, {64, 0},
+  {69, 0}, {71, 0}, {79, 0}, {80, 0},
+  {116, 0}, {202, 0}, {203, 0}, {205, 0},
+  {206, 0}, {207, 0}, {209, 0}, {210, 0},
+  {211, 0}, {213, 0}, {214, 0}, {217, 0},
+  {218, 0}, {219, 0}, {928, 0}, {7264, 0},
+  {10792, 0}, {10795, 0}, {38864, 0}, {CASE_SPECIAL_ + 1, 0},
+};
+
+static const uint8_t case_stage1_[1958] = {
+    0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,   0,   0,  11,  12,  13,  14,  15,  16,  17,
+   18,  19,  20,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,  21,  22,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  23,  24,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  25,   0,   0,  26,  27,   0,
+   28,  28,  29,  28,  30,  31,  32,  33,   0,   0,   0,   0,  34,  35,  36,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,  37,  38,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  39,  40,  28,  41,
+   42,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,  43,  44,   0,  45,  46,  47,  48,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,  49,  50,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,  51,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+   52,  53,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+   54,  55,  56,  57,   0,  58,  59,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  60,  61,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,  62,  63,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,  64,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  65,  66,
+};
+
+static const uint16_t case_stage2_[4288] = {
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 243, 243, 243, 243, 243, 243, 243,
+  243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,   0,   0,   0,   0,   0,
+    0, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+  116, 116, 116,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 141,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,   0,
+  243, 243, 243, 243, 243, 243, 243, 163, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+  116, 116, 116, 116, 116, 116, 116,   0, 116, 116, 116, 116, 116, 116, 116, 135, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 275,  82, 236, 124, 236, 124, 236, 124,
+    0, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 164, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,  30, 236, 124, 236, 124, 236, 124,  81,
+  140, 263, 236, 124, 236, 124, 260, 236, 124, 259, 259, 236, 124,   0, 254, 257, 258, 236, 124, 259, 261, 132, 264, 262,
+  236, 124, 139,   0, 264, 265, 138, 266, 236, 124, 236, 124, 236, 124, 268, 236, 124, 268,   0,   0, 236, 124, 268, 236,
+  124, 267, 267, 236, 124, 236, 124, 269, 236, 124,   0,   0, 236, 124,   0, 128,   0,   0,   0,   0, 237, 235, 123, 237,
+  235, 123, 237, 235, 123, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 100, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 165, 237, 235, 123, 236, 124,  33,  37,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,  27,   0, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,   0,   0,   0,   0,   0,   0, 273, 236, 124,  26, 272, 150,
+  150, 236, 124,  25, 252, 253, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 149, 147, 148,  89,  92,   0,  93,  93,
+    0,  95,   0,  94, 162,   0,   0,   0,  93, 161,   0,  91,   0, 156, 160,   0,  90,  88, 160, 145, 158,   0,   0,  88,
+    0, 146,  87,   0,   0,  86,   0,   0,   0,   0,   0,   0,   0, 144,   0,   0,  84,   0, 159,  84,   0,   0,   0, 157,
+   84, 102,  85,  85, 101,   0,   0,   0,   0,   0,  83,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 155, 154,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 130,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0, 236, 124, 236, 124,   0,   0, 236, 124,   0,   0,   0, 138, 138, 138,   0, 256,
+    0,   0,   0,   0,   0,   0, 246,   0, 245, 245, 245,   0, 251,   0, 250, 250, 166, 243, 243, 243, 243, 243, 243, 243,
+  243, 243, 243, 243, 243, 243, 243, 243, 243, 243,   0, 243, 243, 243, 243, 243, 243, 243, 243, 243, 113, 114, 114, 114,
+  167, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 117, 116, 116, 116, 116, 116,
+  116, 116, 116, 116, 103, 104, 104, 238, 105, 107,   0,   0,   0, 110, 108, 122, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,  98,  99, 125,  96,  36,  97,   0, 236,
+  124,  67, 236, 124,   0,  27,  27,  27, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+  243, 243, 243, 243, 243, 243, 243, 243, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+  116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,  99,  99,  99,  99,  99,  99,  99,  99,
+   99,  99,  99,  99,  99,  99,  99,  99, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,   0,   0,   0,   0,   0,   0,
+    0,   0, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 239, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 121,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+    0, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+  249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+  109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 168,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271,
+  271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271, 271,   0, 271,
+    0,   0,   0,   0,   0, 271,   0,   0, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+  142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142, 142,
+  142, 142, 142,   0,   0, 142, 142, 142,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 274, 274, 274, 274, 274, 274, 274, 274,
+  274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+  274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+  274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274, 274,
+  238, 238, 238, 238, 238, 238,   0,   0, 122, 122, 122, 122, 122, 122,   0,   0,  73,  74,  75,  77,  77,  76,  78,  79,
+  151,   0,   0,   0,   0,   0,   0,   0,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,
+   24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,  24,
+   24,  24,  24,   0,   0,  24,  24,  24,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 152,   0,   0,   0, 143,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 153,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 169, 170, 171, 172, 173, 106,   0,   0,  21,   0, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  126, 126, 126, 126, 126, 126, 126, 126,  42,  42,  42,  42,  42,  42,  42,  42, 126, 126, 126, 126, 126, 126,   0,   0,
+   42,  42,  42,  42,  42,  42,   0,   0, 126, 126, 126, 126, 126, 126, 126, 126,  42,  42,  42,  42,  42,  42,  42,  42,
+  126, 126, 126, 126, 126, 126, 126, 126,  42,  42,  42,  42,  42,  42,  42,  42, 126, 126, 126, 126, 126, 126,   0,   0,
+   42,  42,  42,  42,  42,  42,   0,   0, 174, 126, 175, 126, 176, 126, 177, 126,   0,  42,   0,  42,   0,  42,   0,  42,
+  126, 126, 126, 126, 126, 126, 126, 126,  42,  42,  42,  42,  42,  42,  42,  42, 129, 129, 131, 131, 131, 131, 133, 133,
+  137, 137, 134, 134, 136, 136,   0,   0, 178, 179, 180, 181, 182, 183, 184, 185,  43,  44,  45,  46,  47,  48,  49,  50,
+  186, 187, 188, 189, 190, 191, 192, 193,  51,  52,  53,  54,  55,  56,  57,  58, 194, 195, 196, 197, 198, 199, 200, 201,
+   59,  60,  61,  62,  63,  64,  65,  66, 126, 126, 202, 203, 204,   0, 205, 206,  42,  42,  35,  35,  39,   0,  72,   0,
+    0,   0, 207, 208, 209,   0, 210, 211,  34,  34,  34,  34,  40,   0,   0,   0, 126, 126, 212, 166,   0,   0, 213, 214,
+   42,  42,  32,  32,   0,   0,   0,   0, 126, 126, 215, 167, 216, 125, 217, 218,  42,  42,  31,  31,  67,   0,   0,   0,
+    0,   0, 219, 220, 221,   0, 222, 223,  28,  28,  29,  29,  41,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,  22,   0,   0,   0,  19,  20,   0,   0,   0,   0,   0,   0, 242,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 118,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 240, 240, 240, 240, 240, 240, 240, 240,
+  240, 240, 240, 240, 240, 240, 240, 240, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120,
+    0,   0,   0, 236, 124,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 241, 241,
+  241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 119,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+  249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+  109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+  109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109, 109,
+  236, 124,  17,  23,  18,  69,  70, 236, 124, 236, 124, 236, 124,  15,  16,  13,  14,   0, 236, 124,   0, 236, 124,   0,
+    0,   0,   0,   0,   0,   0,  12,  12, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,   0,   0,   0,   0,
+    0,   0,   0, 236, 124, 236, 124,   0,   0,   0, 236, 124,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+   71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,
+   71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,   0,  71,   0,   0,   0,   0,   0,  71,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+    0,   0, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,   0,   0,   0,   0,   0,   0,   0,   0,
+    0, 236, 124, 236, 124,  11, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,   0,   0,   0, 236, 124,   7,   0,   0,
+  236, 124, 236, 124, 127,   0, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124,   3,   1,   2,   5,   3,   0,   9,   6,   8, 270, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124, 236, 124,
+  236, 124, 236, 124,  38,   4,  10, 236, 124, 236, 124,   0,   0,   0,   0,   0, 236, 124,   0,   0,   0,   0, 236, 124,
+  236, 124,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0, 236, 124,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  80,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  68,  68,  68,  68,  68,  68,  68,  68,
+   68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,
+   68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,
+   68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,  68,
+  224, 225, 226, 227, 228, 229, 229,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 230, 231, 232, 233, 234,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+  243, 243, 243,   0,   0,   0,   0,   0,   0, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+  116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+  248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+  248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,   0,   0,   0,   0,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+  111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 247, 247, 247, 247, 247, 247, 247, 247,
+  247, 247, 247,   0, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247, 247,   0, 247, 247, 247, 247,
+  247, 247, 247,   0, 247, 247,   0, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112, 112,   0, 112, 112, 112, 112, 112,
+  112, 112, 112, 112, 112, 112, 112, 112, 112, 112,   0, 112, 112, 112, 112, 112, 112, 112,   0, 112, 112,   0,   0,   0,
+  251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251,
+  251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251, 251,
+  251, 251, 251,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 103, 103, 103, 103, 103, 103, 103, 103,
+  103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+  103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 243, 243, 243, 243, 243, 243, 243, 243,
+  243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+  116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+  116, 116, 116, 116, 116, 116, 116, 116,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 243, 243, 243, 243, 243, 243, 243, 243,
+  243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+  116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 116,
+  116, 116, 116, 116, 116, 116, 116, 116, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+  244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 115, 115, 115, 115, 115, 115,
+  115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+  115, 115, 115, 115,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+// mappings to 2 or 3 codepoints, 0 padded.
+static const int32_t case_specials_[73][3] = {
+  {0x0053, 0x0053, 0x0000}, {0x0069, 0x0307, 0x0000}, {0x02BC, 0x004E, 0x0000}, {0x004A, 0x030C, 0x0000},
+  {0x0399, 0x0308, 0x0301}, {0x03A5, 0x0308, 0x0301}, {0x0535, 0x0552, 0x0000}, {0x0048, 0x0331, 0x0000},
+  {0x0054, 0x0308, 0x0000}, {0x0057, 0x030A, 0x0000}, {0x0059, 0x030A, 0x0000}, {0x0041, 0x02BE, 0x0000},
+  {0x03A5, 0x0313, 0x0000}, {0x03A5, 0x0313, 0x0300}, {0x03A5, 0x0313, 0x0301}, {0x03A5, 0x0313, 0x0342},
+  {0x1F08, 0x0399, 0x0000}, {0x1F09, 0x0399, 0x0000}, {0x1F0A, 0x0399, 0x0000}, {0x1F0B, 0x0399, 0x0000},
+  {0x1F0C, 0x0399, 0x0000}, {0x1F0D, 0x0399, 0x0000}, {0x1F0E, 0x0399, 0x0000}, {0x1F0F, 0x0399, 0x0000},
+  {0x1F28, 0x0399, 0x0000}, {0x1F29, 0x0399, 0x0000}, {0x1F2A, 0x0399, 0x0000}, {0x1F2B, 0x0399, 0x0000},
+  {0x1F2C, 0x0399, 0x0000}, {0x1F2D, 0x0399, 0x0000}, {0x1F2E, 0x0399, 0x0000}, {0x1F2F, 0x0399, 0x0000},
+  {0x1F68, 0x0399, 0x0000}, {0x1F69, 0x0399, 0x0000}, {0x1F6A, 0x0399, 0x0000}, {0x1F6B, 0x0399, 0x0000},
+  {0x1F6C, 0x0399, 0x0000}, {0x1F6D, 0x0399, 0x0000}, {0x1F6E, 0x0399, 0x0000}, {0x1F6F, 0x0399, 0x0000},
+  {0x1FBA, 0x0399, 0x0000}, {0x0391, 0x0399, 0x0000}, {0x0386, 0x0399, 0x0000}, {0x0391, 0x0342, 0x0000},
+  {0x0391, 0x0342, 0x0399}, {0x1FCA, 0x0399, 0x0000}, {0x0397, 0x0399, 0x0000}, {0x0389, 0x0399, 0x0000},
+  {0x0397, 0x0342, 0x0000}, {0x0397, 0x0342, 0x0399}, {0x0399, 0x0308, 0x0300}, {0x0399, 0x0342, 0x0000},
+  {0x0399, 0x0308, 0x0342}, {0x03A5, 0x0308, 0x0300}, {0x03A1, 0x0313, 0x0000}, {0x03A5, 0x0342, 0x0000},
+  {0x03A5, 0x0308, 0x0342}, {0x1FFA, 0x0399, 0x0000}, {0x03A9, 0x0399, 0x0000}, {0x038F, 0x0399, 0x0000},
+  {0x03A9, 0x0342, 0x0000}, {0x03A9, 0x0342, 0x0399}, {0x0046, 0x0046, 0x0000}, {0x0046, 0x0049, 0x0000},
+  {0x0046, 0x004C, 0x0000}, {0x0046, 0x0046, 0x0049}, {0x0046, 0x0046, 0x004C}, {0x0053, 0x0054, 0x0000},
+  {0x0544, 0x0546, 0x0000}, {0x0544, 0x0535, 0x0000}, {0x0544, 0x053B, 0x0000}, {0x054E, 0x0546, 0x0000},
+  {0x0544, 0x053D, 0x0000},
+};
+
+static int32_t case_value_(int32_t c, enum StrCase kind) {
+  if (c >= CASE_LIMIT_) return 0;
+  return case_values_[case_stage2_[(case_stage1_[c >> 6] << 6) | (c & 63)]][kind];
+}
+
+// write the mapping of c, return the size after it.
+static Ssize case_put_(int32_t c, enum StrCase kind, uint8_t *out, Ssize capacity, Ssize size) {
+  const int32_t value = case_value_(c, kind);
+  uint8_t bytes[4];
+
+  if (value < CASE_SPECIAL_) return escape_put_(out, capacity, size, bytes, encode_utf8_(c + value, bytes));
+
+  const int32_t *mapping = case_specials_[value - CASE_SPECIAL_];
+  for (int k = 0; k < 3 && mapping[k] != 0; ++k) {
+    size = escape_put_(out, capacity, size, bytes, encode_utf8_(mapping[k], bytes));
+  }
+
+  return size;
+}
+
+// size of the leading run of ascii bytes that the mapping keeps.
+static Ssize case_run_(const uint8_t *p, Ssize size, enum StrCase kind) {
+  const uint8_t first = (kind == STR_CASE_LOWER) ? 'A' : 'a';
+  Ssize i = 0;
+
+  // letters to map are moved to [-128, -103] to be found by one signed compare
+#if defined(__AVX2__)
+  const __m256i shift = _mm256_set1_epi8((char)(128 - first));
+  const __m256i bound = _mm256_set1_epi8(-128 + 26);
+  for (; i + 32 <= size; i += 32) {
+    const __m256i x = _mm256_loadu_si256((const __m256i*)(p + i));
+    const __m256i letters = _mm256_cmpgt_epi8(bound, _mm256_add_epi8(x, shift));
+    const uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(x, letters));
+    if (mask != 0) return i + ctz64_(mask);
+  }
+#elif defined(__SSE2__)
+  const __m128i shift = _mm_set1_epi8((char)(128 - first));
+  const __m128i bound = _mm_set1_epi8(-128 + 26);
+  for (; i + 16 <= size; i += 16) {
+    const __m128i x = _mm_loadu_si128((const __m128i*)(p + i));
+    const __m128i letters = _mm_cmpgt_epi8(bound, _mm_add_epi8(x, shift));
+    const uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_or_si128(x, letters));
+    if (mask != 0) return i + ctz64_(mask);
+  }
+#endif
+
+  for (; i < size; ++i) {
+    if (p[i] >= 0x80 || (unsigned)(p[i] - first) < 26) break;
+  }
+
+  return i;
+}
+
+// map the leading run of ascii bytes of p into out, which may be p.
+// return the size of the run.
+static Ssize case_ascii_(const uint8_t *p, uint8_t *out, Ssize size, enum StrCase kind) {
+  const uint8_t first = (kind == STR_CASE_LOWER) ? 'A' : 'a';
+  Ssize i = 0;
+
+#if defined(__AVX2__)
+  const __m256i shift = _mm256_set1_epi8((char)(128 - first));
+  const __m256i bound = _mm256_set1_epi8(-128 + 26);
+  const __m256i flip = _mm256_set1_epi8(0x20);
+  for (; i + 32 <= size; i += 32) {
+    const __m256i x = _mm256_loadu_si256((const __m256i*)(p + i));
+    if (_mm256_movemask_epi8(x) != 0) break;
+    const __m256i letters = _mm256_cmpgt_epi8(bound, _mm256_add_epi8(x, shift));
+    _mm256_storeu_si256((__m256i*)(out + i), _mm256_xor_si256(x, _mm256_and_si256(letters, flip)));
+  }
+#elif defined(__SSE2__)
+  const __m128i shift = _mm_set1_epi8((char)(128 - first));
+  const __m128i bound = _mm_set1_epi8(-128 + 26);
+  const __m128i flip = _mm_set1_epi8(0x20);
+  for (; i + 16 <= size; i += 16) {
+    const __m128i x = _mm_loadu_si128((const __m128i*)(p + i));
+    if (_mm_movemask_epi8(x) != 0) break;
+    const __m128i letters = _mm_cmpgt_epi8(bound, _mm_add_epi8(x, shift));
+    _mm_storeu_si128((__m128i*)(out + i), _mm_xor_si128(x, _mm_and_si128(letters, flip)));
+  }
+#endif
+
+  for (; i < size && p[i] < 0x80; ++i) {
+    out[i] = ((unsigned)(p[i] - first) < 26) ? (uint8_t)(p[i] ^ 0x20) : p[i];
+  }
+
+  return i;
+}
+
+// offset of the first codepoint that the mapping changes, s8.size if none.
+static Ssize case_first_(UTF8View s8, enum StrCase kind) {
+  Ssize i = 0;
+
+  for (;;) {
+    i += case_run_(s8.data + i, s8.size - i, kind);
+    if (i == s8.size || s8.data[i] < 0x80) return i;
+
+    const UTF8View rest = {s8.data + i, s8.size - i};
+    const struct CodeResult cr = UTF8View_get_codepoint(rest);
+    if (case_value_(cr.codepoint, kind) != 0) return i;
+    i += cr.size;
+  }
+}
+
+Ssize UTF8View_case_size(UTF8View s8, enum StrCase kind) {
+  Ssize size = 0;
+
+  for (Ssize i = 0; i < s8.size;) {
+    const Ssize run = ascii_run_(s8.data + i, s8.size - i, 0x80);
+    size += run;
+    i += run;
+    if (i == s8.size) break;
+
+    const UTF8View rest = {s8.data + i, s8.size - i};
+    const struct CodeResult cr = UTF8View_get_codepoint(rest);
+    size = case_put_(cr.codepoint, kind, NULL, 0, size);
+    i += cr.size;
+  }
+
+  return size;
+}
+
+UTF8View UTF8View_to_case(UTF8View s8, enum StrCase kind, uint8_t *out, Ssize capacity) {
+  Ssize i = case_first_(s8, kind);
+  if (i == s8.size) return s8;
+
+  Ssize size = escape_put_(out, capacity, 0, s8.data, i);
+  while (i < s8.size) {
+    if (s8.data[i] < 0x80) {
+      // map ascii straight into out while it fits, else only count
+      const Ssize rest = s8.size - i;
+      const Ssize room = capacity - size;
+      const Ssize run = (room > 0) ? case_ascii_(s8.data + i, out + size, rest < room ? rest : room, kind)
+                                   : ascii_run_(s8.data + i, rest, 0x80);
+      size += run;
+      i += run;
+      continue;
     }
+
+    const UTF8View rest = {s8.data + i, s8.size - i};
+    const struct CodeResult cr = UTF8View_get_codepoint(rest);
+    size = case_put_(cr.codepoint, kind, out, capacity, size);
+    i += cr.size;
   }
-  if (!is_valid) {
-    cr.codepoint = CODEPOINT_INVALID;
+
+  if (size > capacity) {
+    const UTF8View too_small = {NULL, -size};
+    return too_small;
   }
 
-  return cr;
+  const UTF8View mapped = {out, size};
+  return mapped;
 }
 
-StrView StrView_cast(UTF8View s8) {
-  StrView s = {s8.data, s8.size};
-  return s;
-}
+Ssize UTF8View_to_case_inplace(uint8_t *data, Ssize size, enum StrCase kind) {
+  Ssize i = 0;
 
-StrView StrView_from_raw(const void *ptr, Ssize size) {
-  StrView s = {(const uint8_t*)ptr, size};
-  return s;
-}
+  while (i < size) {
+    i += case_ascii_(data + i, data + i, size - i, kind);
+    if (i == size) break;
 
-StrView StrView_from_cstr(const char *s) {
-  StrView cstr = {(const uint8_t*)s, (Ssize)strlen(s)};
-  return cstr;
+    const UTF8View rest = {data + i, size - i};
+    const struct CodeResult cr = UTF8View_get_codepoint(rest);
+    uint8_t bytes[12];
+    if (case_put_(cr.codepoint, kind, bytes, sizeof(bytes), 0) != cr.size) break;
+    memcpy(data + i, bytes, (Usize)cr.size);
+    i += cr.size;
+  }
+
+  return i;
 }
 
-UTF8View UTF8View_from_strview(StrView s) {
-  UTF8View s8 = {s.data, 0};
-  
-  struct CodeResult cr;
-  while (cr = StrView_try_decode(s), cr.codepoint != CODEPOINT_INVALID) {
-    s8.size += cr.size;
-    s.data  += cr.size;
-    s.size  -= cr.size;
-  }
+//----------------------------------------------------------------------------
+// batch
+//----------------------------------------------------------------------------
 
-  // set size <= 0 for uncomplete decoding
-  if (s.size != 0) {
-    s8.size = - s8.size;
-  }
+#define BATCH_ASCII_ 0
+#define BATCH_CONTINUATION_ 1
 
-  return s8;
+static int popcount64_(uint64_t x) {
+#if defined(__GNUC__)
+  return __builtin_popcountll(x);
+#else
+  int n = 0;
+  for (; x != 0; x &= x - 1) ++n;
+  return n;
+#endif
 }
 
-struct CodeResult UTF8View_get_codepoint(UTF8View s8) {
-  struct CodeResult cr = {CODEPOINT_INVALID, 0};
+static uint64_t rotl64_(uint64_t x, int r) {
+  return (x << r) | (x >> (64 - r));
+}
 
-  assert(s8.size > 0);
-  if (s8.size > 0) {
-    cr = decode_lead_(s8.data[0]);
-    assert(cr.size <= s8.size);
+static uint64_t hash_mix_(uint64_t k) {
+  k *= 0x87C37B91114253D5ull;
+  k = rotl64_(k, 31);
+  return k * 0x4CF5AD432745937Full;
+}
 
-    for (int i = 1; i < cr.size; ++i) {
-      cr.codepoint = (cr.codepoint << 6) | (s8.data[i] & 0x3F);
-    }
- }
+uint64_t StrView_hash(StrView s, uint64_t seed) {
+  uint64_t h = seed ^ ((uint64_t)s.size * 0x9E3779B97F4A7C15ull);
+  Ssize i = 0;
 
-  return cr;
+  for (; i + 8 <= s.size; i += 8) {
+    uint64_t k;
+    memcpy(&k, s.data + i, sizeof(k));
+    h ^= hash_mix_(k);
+    h = rotl64_(h, 27) * 5 + 0x52DCE729;
+  }
+  if (i < s.size) {
+    uint64_t k = 0;
+    memcpy(&k, s.data + i, (Usize)(s.size - i));
+    h ^= hash_mix_(k);
+  }
+
+  // murmur3 finalizer
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDull;
+  h ^= h >> 33;
+  h *= 0xC4CEB9FE1A85EC53ull;
+  h ^= h >> 33;
+
+  return h;
 }
 
-struct CodeResult StrView_try_decode(StrView s) {
-  struct CodeResult cr = {CODEPOINT_INVALID, 0};
-  
-  if (s.size > 0) {
-    cr = decode_lead_(s.data[0]);
-    cr = decode_tail_(cr, s);
-  }
-  
-  return cr;
+StrView StrColumn_get(StrColumn column, Ssize i) {
+  assert(i >= 0 && i < column.count);
+
+  const StrView s = {column.bytes + column.offsets[i], column.offsets[i + 1] - column.offsets[i]};
+  return s;
 }
 
-Ssize UTF8View_count_codepoint(UTF8View s8) {
-  Ssize count = 0;
-  
-  while (s8.size > 0) {
-    struct CodeResult cr = UTF8View_get_codepoint(s8);
-    s8.data += cr.size;
-    s8.size -= cr.size;
-    count++;
+// bit i is set for non ascii bytes or for continuation bytes of p[i].
+static uint64_t batch_mask64_(const uint8_t *p, int kind) {
+#if defined(__AVX2__)
+  __m256i lo = _mm256_loadu_si256((const __m256i*)p);
+  __m256i hi = _mm256_loadu_si256((const __m256i*)(p + 32));
+  if (kind == BATCH_CONTINUATION_) {
+    // continuation bytes are the signed values below -64
+    const __m256i bound = _mm256_set1_epi8(-64);
+    lo = _mm256_cmpgt_epi8(bound, lo);
+    hi = _mm256_cmpgt_epi8(bound, hi);
   }
-  
-  return count;
+  return (uint32_t)_mm256_movemask_epi8(lo) | ((uint64_t)(uint32_t)_mm256_movemask_epi8(hi) << 32);
+#elif defined(__SSE2__)
+  uint64_t mask = 0;
+  for (int i = 0; i < 4; ++i) {
+    __m128i x = _mm_loadu_si128((const __m128i*)(p + 16 * i));
+    if (kind == BATCH_CONTINUATION_) x = _mm_cmpgt_epi8(_mm_set1_epi8(-64), x);
+    mask |= (uint64_t)(uint16_t)_mm_movemask_epi8(x) << (16 * i);
+  }
+  return mask;
+#else
+  uint64_t mask = 0;
+  for (int i = 0; i < 64; ++i) {
+    const bool flag = (kind == BATCH_CONTINUATION_) ? (p[i] & 0xC0) == 0x80 : p[i] >= 0x80;
+    mask |= (uint64_t)flag << i;
+  }
+  return mask;
+#endif
 }
 
-Ssize StrView_count_codepoint(StrView s) {
-  Ssize count = 0;
-  
-  while (s.size > 0) {
-    struct CodeResult cr = StrView_try_decode(s);
-    Ssize size = (cr.codepoint != CODEPOINT_INVALID) ? cr.size : 1;
+// running count of flagged bytes over the bytes of a column.
+struct BatchRank_ {
+  const uint8_t *bytes;
+  Ssize end;
+  Ssize block;
+  uint64_t mask;
+  Ssize before;
+  int kind;
+};
 
-    s.data += size;
-    s.size -= size;
-    count += size;
-  }
-  
-  return count;
+static uint64_t batch_block_(const struct BatchRank_ *rank) {
+  if (rank->block + 64 <= rank->end) return batch_mask64_(rank->bytes + rank->block, rank->kind);
+
+  // zero bytes are never flagged
+  uint8_t tail[64] = {0};
+  if (rank->end > rank->block) memcpy(tail, rank->bytes + rank->block, (Usize)(rank->end - rank->block));
+  return batch_mask64_(tail, rank->kind);
 }
 
-bool StrView_is_empty(StrView s) {
-  return s.size == 0;
+static void batch_rank_init_(struct BatchRank_ *rank, StrColumn column, int kind) {
+  rank->bytes = column.bytes;
+  rank->end = column.offsets[column.count];
+  rank->block = column.offsets[0];
+  rank->before = 0;
+  rank->kind = kind;
+  rank->mask = batch_block_(rank);
 }
 
-bool StrView_is_valid_utf8(StrView s) {
-  UTF8View s8 = UTF8View_from_strview(s);
-  
-  return s8.size == s.size;
+// number of flagged bytes before pos.
+// @pre pos is not before the pos of the previous call
+static Ssize batch_rank_(struct BatchRank_ *rank, Ssize pos) {
+  while (pos >= rank->block + 64) {
+    rank->before += popcount64_(rank->mask);
+    rank->block += 64;
+    rank->mask = batch_block_(rank);
+  }
+
+  const int shift = (int)(pos - rank->block);
+  const uint64_t below = (shift == 0) ? 0 : rank->mask & (~(uint64_t)0 >> (64 - shift));
+  return rank->before + popcount64_(below);
 }
 
-int StrView_compare(StrView s1, StrView s2) {
-  const Ssize min_size = s1.size < s2.size ? s1.size : s2.size;
-  assert(min_size >= 0);// FIXME
-  
-  int result = memcmp(s1.data, s2.data, (Usize)min_size);
-  return (result != 0) ? result : s1.size - s2.size;
+static bool batch_is_valid_utf8_(StrView s) {
+  const Ssize ascii = ascii_run_(s.data, s.size, 0x80);
+  return ascii == s.size || StrView_is_valid_utf8(StrView_skip(s, ascii));
 }
 
-bool StrView_is_equal(StrView s1, StrView s2) {
-  assert(s1.size >= 0);
+// continuation bytes of p, 64 at a time.
+static Ssize batch_continuations_(const uint8_t *p, Ssize size) {
+  Ssize count = 0;
+  Ssize i = 0;
 
-  if (s1.size == s2.size) return !memcmp(s1.data, s2.data, (Usize)s1.size);
+  for (; i + 64 <= size; i += 64) count += popcount64_(batch_mask64_(p + i, BATCH_CONTINUATION_));
+  for (; i < size; ++i) count += (p[i] & 0xC0) == 0x80;
 
-  return false;
+  return count;
 }
 
-bool StrView_starts_with(StrView s, StrView prefix) {
-  assert(prefix.size >= 0);
-
-  if (s.size >= prefix.size)
-    return memcmp(s.data, prefix.data, (Usize)prefix.size) == 0;
+static int8_t batch_order_(StrView s, StrView value) {
+  const int order = StrView_compare(s, value);
+  return (int8_t)((order > 0) - (order < 0));
+}
 
-  return false;
+// set or clear bit i of a bitmap being written word by word.
+static void batch_bit_(uint64_t *bitmap, Ssize i, bool bit) {
+  if (i % 64 == 0) bitmap[i / 64] = 0;
+  bitmap[i / 64] |= (uint64_t)bit << (i % 64);
 }
 
-bool StrView_ends_with(StrView s, StrView suffix) {
-  assert(suffix.size >= 0);
+Ssize StrView_batch_is_valid_utf8(const StrView *views, Ssize count, uint64_t *valid) {
+  Ssize total = 0;
 
-  if (s.size >= suffix.size) {
-    const Ssize pos = s.size - suffix.size;
-    return memcmp(s.data + pos, suffix.data, (Usize)suffix.size) == 0;
+  for (Ssize i = 0; i < count; ++i) {
+    const bool bit = batch_is_valid_utf8_(views[i]);
+    batch_bit_(valid, i, bit);
+    total += bit;
   }
 
-  return false;
+  return total;
 }
 
-bool StrView_contains(StrView s, StrView match) {
-  return StrView_find(s, match) >= 0;
+void StrView_batch_count_codepoint(const StrView *views, Ssize count, Ssize *counts) {
+  for (Ssize i = 0; i < count; ++i) {
+    counts[i] = views[i].size - batch_continuations_(views[i].data, views[i].size);
+  }
 }
 
-StrView StrView_skip(StrView s, Ssize count) {
-  assert(count >= 0 && count <= s.size); // FIXME
-    
-  s.data += count;
-  s.size -= count;
-  
-  return s;
+void StrView_batch_hash(const StrView *views, Ssize count, uint64_t seed, uint64_t *hashes) {
+  for (Ssize i = 0; i < count; ++i) {
+    hashes[i] = StrView_hash(views[i], seed);
+  }
 }
 
-StrView StrView_skip_if(StrView s, Bool (*predicate)(int c)) {
-  Ssize i = 0;
-  while( i < s.size && predicate(s.data[i])) {
-    ++i;
+Ssize StrView_batch_is_equal(const StrView *views, Ssize count, StrView value, uint64_t *equal) {
+  Ssize total = 0;
+
+  for (Ssize i = 0; i < count; ++i) {
+    const bool bit = views[i].size == value.size
+                     && (value.size == 0 || memcmp(views[i].data, value.data, (Usize)value.size) == 0);
+    batch_bit_(equal, i, bit);
+    total += bit;
   }
-  s.data += i;
-  s.size -= i;
-  
-  return s;
+
+  return total;
 }
 
-StrView StrView_rskip_if(StrView s, Bool (*predicate)(int c)) {
-  Ssize i = 0;
-  while(i < s.size && predicate(s.data[s.size - 1 - i])) {
-    ++i;
+void StrView_batch_compare(const StrView *views, Ssize count, StrView value, int8_t *orders) {
+  for (Ssize i = 0; i < count; ++i) {
+    orders[i] = batch_order_(views[i], value);
   }
-  s.size -= i;
-  
-  return s;
 }
 
-StrView StrView_trim(StrView s) {
-  return StrView_rskip_if(StrView_skip_if(s, isspace), isspace);
-}
+Ssize StrColumn_is_valid_utf8(StrColumn column, uint64_t *valid) {
+  struct BatchRank_ rank;
+  Ssize total = 0;
 
-StrView StrView_substr(StrView s, Ssize pos, Ssize size) {
-  StrView sub = {NULL, 0};  
+  if (column.count <= 0) return 0;
+  batch_rank_init_(&rank, column, BATCH_ASCII_);
 
-  if (pos < 0) pos += s.size;
-  if (pos >= 0 && pos <= s.size) {
-    const Ssize max_size = s.size - pos;
-    sub.data = s.data + pos;
-    sub.size = ( size >= 0 && size <= max_size) ? size : max_size;
+  Ssize start = batch_rank_(&rank, column.offsets[0]);
+  for (Ssize i = 0; i < column.count; ++i) {
+    const Ssize end = batch_rank_(&rank, column.offsets[i + 1]);
+    const bool bit = end == start || StrView_is_valid_utf8(StrColumn_get(column, i));
+    batch_bit_(valid, i, bit);
+    total += bit;
+    start = end;
   }
 
-  return sub;
+  return total;
 }
 
-Ssize StrView_find(StrView s, StrView match) {
-  assert(match.size >= 0);
+void StrColumn_count_codepoint(StrColumn column, Ssize *counts) {
+  struct BatchRank_ rank;
 
-  Ssize pos = 0;
-  while (s.size - pos >= match.size) {
-    if (memcmp(s.data + pos, match.data, (Usize)match.size) == 0) return pos;
-    pos++;
+  if (column.count <= 0) return;
+  batch_rank_init_(&rank, column, BATCH_CONTINUATION_);
+
+  Ssize start = batch_rank_(&rank, column.offsets[0]);
+  for (Ssize i = 0; i < column.count; ++i) {
+    const Ssize end = batch_rank_(&rank, column.offsets[i + 1]);
+    counts[i] = (column.offsets[i + 1] - column.offsets[i]) - (end - start);
+    start = end;
   }
+}
 
-  return -1;
+void StrColumn_hash(StrColumn column, uint64_t seed, uint64_t *hashes) {
+  for (Ssize i = 0; i < column.count; ++i) {
+    hashes[i] = StrView_hash(StrColumn_get(column, i), seed);
+  }
 }
 
-Ssize StrView_rfind(StrView s, StrView match) {
-  assert(match.size >= 0);
+Ssize StrColumn_is_equal(StrColumn column, StrView value, uint64_t *equal) {
+  const int32_t *offsets = column.offsets;
+  Ssize total = 0;
 
-  Ssize pos = s.size - match.size;
-  while (pos >= 0) {
-    if (memcmp(s.data + pos, match.data, (Usize)match.size) == 0) break;
-    pos--;
+  for (Ssize i = 0; i < column.count; ++i) {
+    const bool bit = offsets[i + 1] - offsets[i] == value.size
+                     && (value.size == 0 || memcmp(column.bytes + offsets[i], value.data, (Usize)value.size) == 0);
+    batch_bit_(equal, i, bit);
+    total += bit;
   }
 
-  return pos;
+  return total;
 }
 
-Ssize StrView_index_of(StrView s, uint8_t c) {
-  for (Ssize i = 0; i < s.size; ++i) {
-    if (s.data[i] == c) return i;
+void StrColumn_compare(StrColumn column, StrView value, int8_t *orders) {
+  for (Ssize i = 0; i < column.count; ++i) {
+    orders[i] = batch_order_(StrColumn_get(column, i), value);
   }
+}
 
-  return -1;
+//----------------------------------------------------------------------------
+// grapheme clusters and width
+//----------------------------------------------------------------------------
+
+#define GRAPHEME_LIMIT_ 0xE1000
+
+// grapheme cluster break values
+#define GB_OTHER_        0
+#define GB_CR_           1
+#define GB_LF_           2
+#define GB_CONTROL_      3
+#define GB_EXTEND_       4
+#define GB_ZWJ_          5
+#define GB_RI_           6
+#define GB_PREPEND_      7
+#define GB_SPACING_MARK_ 8
+#define GB_L_            9
+#define GB_V_            10
+#define GB_T_            11
+#define GB_LV_           12
+#define GB_LVT_          13
+#define GB_EXT_PICT_     14
+
+// tables generated from Unicode 14.0.0 data (perl Unicode::UCD).
+// properties: grapheme break | width << 4, two level lookup of 128
+// codepoints blocks up to U+E1000.
+static const uint8_t grapheme_stage1_[7200] = {
+    0,   1,   2,   2,   2,   2,   3,   2,   2,   4,   2,   5,   6,   7,   8,   9,  10,  11,  12,  13,
+   14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,   2,   2,  30,   2,
+    2,   2,   2,   2,   2,   2,  31,  32,  33,  34,  35,   2,  36,  37,  38,  39,  40,  41,   2,  42,
+    2,   2,   2,   2,  43,  44,  45,  46,   2,   2,  47,  48,   2,  49,   2,  50,  51,  52,  53,  54,
+    2,   2,  55,   2,   2,   2,  56,   2,   2,  57,  58,  59,   2,  60,  61,  62,  63,  64,  65,  66,
+   67,  68,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  69,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  70,   2,   2,  71,  72,   2,   2,  73,  74,  75,  76,
+   77,  78,   2,  79,  80,  81,  82,  83,  84,  85,  86,  80,  81,  82,  83,  84,  85,  86,  80,  81,
+   82,  83,  84,  85,  86,  80,  81,  82,  83,  84,  85,  86,  80,  81,  82,  83,  84,  85,  86,  80,
+   81,  82,  83,  84,  85,  86,  80,  81,  82,  83,  84,  85,  86,  80,  81,  82,  83,  84,  85,  86,
+   80,  81,  82,  83,  84,  85,  86,  80,  81,  82,  83,  84,  85,  86,  80,  81,  82,  83,  84,  85,
+   86,  80,  81,  82,  83,  84,  85,  86,  80,  81,  82,  87,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,  61,  61,
+   61,  61,  88,   2,   2,   2,   2,   2,  89,  90,  91,  92,   2,   2,   2,  93,   2,  94,  95,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,  96,  97,   2,   2,   2,   2,  98,   2,
+    2,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108,   2, 109, 110,   2, 111, 112, 113, 114,   2,
+  115,   2, 116, 117, 118, 119,   2,   2, 120, 121, 122, 123,   2, 124,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 125,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2, 126, 127,   2,   2,   2,   2,   2,   2,   2, 128, 129,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61, 130,  61,  61,  61,  61,  61,  61,  61,  61,  61, 131, 132,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2, 133,  61,  61, 134,  61,  61, 135,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2, 136,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2, 137,   2,   2,   2, 138, 139, 140,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2, 141, 142,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+  143,   2, 127,   2,   2, 144,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 145, 146,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 147, 148, 149, 150, 151, 152, 153, 154,
+  155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168,   2,   2, 152, 152, 152, 152,
+  152, 152, 152, 169,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61, 170,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+   61,  61,  61,  61,  61,  61,  61, 170,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+    2,   2,   2,   2,   2,   2,   2,   2, 171, 172, 173, 174, 172, 172, 172, 172, 172, 172, 172, 172,
+  172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172, 172,
+};
+
+static const uint8_t grapheme_stage2_[22400] = {
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x03, 0x03, 0x01, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10, 0x13, 0x1E, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x04,
+  0x10, 0x04, 0x04, 0x10, 0x04, 0x04, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x03, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x07, 0x10, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x04, 0x04, 0x10, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x07,
+  0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x10, 0x04, 0x04, 0x04, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x07, 0x07, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x07, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x18, 0x04, 0x10, 0x18, 0x18,
+  0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x18, 0x18, 0x18, 0x04, 0x18, 0x18,
+  0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x04, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x14, 0x18,
+  0x18, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x18, 0x18, 0x10, 0x10, 0x18, 0x18, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10,
+  0x10, 0x04, 0x04, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x18, 0x18,
+  0x18, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x04, 0x04, 0x04, 0x10, 0x10,
+  0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x04, 0x04, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x18, 0x18,
+  0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x04, 0x04, 0x18, 0x10, 0x18, 0x18, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x10, 0x04, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x14, 0x04,
+  0x18, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x18, 0x18, 0x10, 0x10, 0x18, 0x18, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x18,
+  0x04, 0x18, 0x18, 0x10, 0x10, 0x10, 0x18, 0x18, 0x18, 0x10, 0x18, 0x18, 0x18, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x18, 0x18, 0x18, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x04, 0x04,
+  0x04, 0x18, 0x18, 0x18, 0x18, 0x10, 0x04, 0x04, 0x04, 0x10, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x04, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x18, 0x04,
+  0x18, 0x18, 0x14, 0x18, 0x18, 0x10, 0x04, 0x18, 0x18, 0x10, 0x18, 0x18, 0x04, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x10, 0x14, 0x18,
+  0x18, 0x04, 0x04, 0x04, 0x04, 0x10, 0x18, 0x18, 0x18, 0x10, 0x18, 0x18, 0x18, 0x04, 0x17, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x04, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x14,
+  0x18, 0x18, 0x04, 0x04, 0x04, 0x10, 0x04, 0x10, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x14,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x04, 0x10, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x04, 0x10, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x04, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x18, 0x18,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04,
+  0x04, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x04, 0x04, 0x18, 0x18, 0x04, 0x04, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04,
+  0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x10, 0x18, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+  0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+  0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+  0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+  0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x04, 0x04, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x04, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x04, 0x18, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x03, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x18, 0x18, 0x18, 0x18, 0x04, 0x04, 0x18, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10,
+  0x18, 0x18, 0x04, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x18, 0x18, 0x04, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x04, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10,
+  0x04, 0x10, 0x04, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x04, 0x14, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x04, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x04, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x18, 0x04, 0x04, 0x04, 0x04, 0x18, 0x18, 0x04, 0x04, 0x18, 0x04, 0x04, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x18, 0x04, 0x04, 0x18, 0x18, 0x18, 0x04, 0x18, 0x04,
+  0x04, 0x04, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x18, 0x18, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x18, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x03, 0x04, 0x05, 0x03, 0x03,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x13, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x2E, 0x2E, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x1E, 0x1E, 0x2E, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x2E, 0x2E, 0x10,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x10, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x10, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x1E, 0x1E, 0x1E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x2E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x2E, 0x2E, 0x1E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x1E, 0x1E, 0x2E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x10, 0x10, 0x1E, 0x1E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x10, 0x1E, 0x10, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x10, 0x10,
+  0x10, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x2E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x1E, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x2E, 0x10, 0x2E, 0x10,
+  0x10, 0x10, 0x10, 0x2E, 0x2E, 0x2E, 0x10, 0x2E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x2E, 0x2E, 0x2E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x2E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x2E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x2E, 0x2E, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x2E, 0x10, 0x10, 0x10, 0x10, 0x2E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04,
+  0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x04, 0x04, 0x04, 0x04, 0x24, 0x24,
+  0x2E, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x20, 0x10,
+  0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x04, 0x04, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x20, 0x2E, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04,
+  0x04, 0x04, 0x04, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x18, 0x18, 0x04, 0x04, 0x18, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x29, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x04, 0x18, 0x18, 0x04, 0x04, 0x04, 0x04, 0x18, 0x18, 0x04, 0x04, 0x18, 0x18,
+  0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18,
+  0x18, 0x04, 0x04, 0x18, 0x18, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x18, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x10, 0x04, 0x04, 0x04, 0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04,
+  0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x04, 0x04, 0x18, 0x18,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x18, 0x18, 0x04, 0x18, 0x18, 0x04, 0x18, 0x18, 0x10, 0x18, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2C, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D, 0x2D,
+  0x2D, 0x2D, 0x2D, 0x2D, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A,
+  0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B,
+  0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x03,
+  0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x14,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x03, 0x03, 0x03, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x04, 0x04, 0x04, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x18, 0x04, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x10, 0x10, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04,
+  0x04, 0x04, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x18, 0x18, 0x18, 0x04, 0x04, 0x04, 0x04, 0x18, 0x18, 0x04, 0x04, 0x10, 0x10, 0x07, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x07, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x18, 0x18, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18,
+  0x18, 0x10, 0x17, 0x17, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x10, 0x18, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x18, 0x04,
+  0x04, 0x04, 0x18, 0x18, 0x04, 0x18, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04,
+  0x18, 0x18, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x10, 0x14, 0x18,
+  0x04, 0x18, 0x18, 0x18, 0x18, 0x10, 0x10, 0x18, 0x18, 0x10, 0x10, 0x18, 0x18, 0x18, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x18, 0x18, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x18, 0x18, 0x04, 0x04, 0x04, 0x18, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x14, 0x18, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x04, 0x18, 0x18, 0x14, 0x18, 0x04,
+  0x04, 0x18, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x14,
+  0x18, 0x18, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x18, 0x18, 0x18, 0x18, 0x04, 0x04, 0x18, 0x04,
+  0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x18, 0x18, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x18, 0x04, 0x18, 0x04,
+  0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x18, 0x04, 0x18, 0x18,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04,
+  0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x18, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x14, 0x18, 0x18, 0x18, 0x18, 0x18, 0x10, 0x18, 0x18, 0x10, 0x10, 0x04, 0x04, 0x18, 0x04, 0x17,
+  0x18, 0x17, 0x18, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x18, 0x18, 0x18, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x04, 0x04, 0x18, 0x18, 0x18, 0x18,
+  0x04, 0x10, 0x10, 0x10, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x17, 0x04, 0x04, 0x04, 0x04, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x18, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x18, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x18, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x18, 0x04, 0x04, 0x18, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x04, 0x10, 0x04, 0x04, 0x10, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x17, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x18, 0x18, 0x18, 0x10,
+  0x04, 0x04, 0x10, 0x18, 0x18, 0x04, 0x18, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x04, 0x04, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04,
+  0x10, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04,
+  0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x28, 0x28, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x20, 0x20, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x10,
+  0x03, 0x03, 0x03, 0x03, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x14, 0x18, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x18, 0x14, 0x14,
+  0x14, 0x14, 0x14, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x10, 0x04, 0x04, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x1E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x2E, 0x10,
+  0x10, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+  0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+  0x20, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2E,
+  0x20, 0x20, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x20, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x1E, 0x1E, 0x1E, 0x2E, 0x1E, 0x1E, 0x1E, 0x2E, 0x2E, 0x2E, 0x24, 0x24, 0x24, 0x24, 0x24,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E,
+  0x2E, 0x1E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x2E, 0x2E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x10, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x10, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E,
+  0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x1E, 0x10, 0x10,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10,
+  0x13, 0x03, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13, 0x13,
+};
+
+static unsigned grapheme_props_(int32_t c) {
+  if (c >= GRAPHEME_LIMIT_) return GB_OTHER_ | 1 << 4;
+  return grapheme_stage2_[(grapheme_stage1_[c >> 7] << 7) | (c & 127)];
 }
 
-Ssize StrView_find_first_of(StrView s, StrView accept) {
-  uint8_t freq[256] = {0};
+// size of the leading run of printable ascii bytes.
+static Ssize grapheme_run_(const uint8_t *p, Ssize size) {
+  Ssize i = 0;
 
-  for (Ssize i = 0; i < accept.size; ++i) {
-    freq[accept.data[i]]++;
+  // printable bytes are the signed values in [0x20, 0x7E]
+#if defined(__AVX2__)
+  const __m256i below = _mm256_set1_epi8(0x1F);
+  const __m256i above = _mm256_set1_epi8(0x7F);
+  for (; i + 32 <= size; i += 32) {
+    const __m256i x = _mm256_loadu_si256((const __m256i*)(p + i));
+    const __m256i printable = _mm256_and_si256(_mm256_cmpgt_epi8(x, below), _mm256_cmpgt_epi8(above, x));
+    const uint32_t mask = ~(uint32_t)_mm256_movemask_epi8(printable);
+    if (mask != 0) return i + ctz64_(mask);
   }
-  
-  for (Ssize pos = 0; pos < s.size; ++pos) {
-    if (freq[s.data[pos]] != 0) return pos;
+#elif defined(__SSE2__)
+  const __m128i below = _mm_set1_epi8(0x1F);
+  const __m128i above = _mm_set1_epi8(0x7F);
+  for (; i + 16 <= size; i += 16) {
+    const __m128i x = _mm_loadu_si128((const __m128i*)(p + i));
+    const __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(x, below), _mm_cmpgt_epi8(above, x));
+    const uint32_t mask = 0xFFFF ^ (uint32_t)_mm_movemask_epi8(printable);
+    if (mask != 0) return i + ctz64_(mask);
   }
-  
-  return -1;
+#endif
+
+  for (; i < size; ++i) {
+    if (p[i] < 0x20 || p[i] > 0x7E) break;
+  }
+
+  return i;
 }
 
-Ssize StrView_find_first_not_of(StrView s, StrView reject) {
-  uint8_t freq[256] = {0};
+static bool grapheme_is_control_(unsigned gb) {
+  return gb == GB_CR_ || gb == GB_LF_ || gb == GB_CONTROL_;
+}
 
-  for (Ssize i = 0; i < reject.size; ++i) {
-    freq[reject.data[i]]++;
+// size of the first cluster of p, receive its width.
+// @pre size > 0
+static Ssize grapheme_next_(const uint8_t *p, Ssize size, int *width) {
+  if (p[0] >= 0x20 && p[0] <= 0x7E && (size == 1 || p[1] < 0x80)) {
+    *width = 1;
+    return 1;
   }
-  
-  for (Ssize pos = 0; pos < s.size; ++pos) {
-    if (freq[s.data[pos]] == 0) return pos;
+
+  UTF8View rest = {p, size};
+  struct CodeResult cr = UTF8View_get_codepoint(rest);
+  unsigned props = grapheme_props_(cr.codepoint);
+  unsigned previous = props & 15;
+  const bool pictographic = previous == GB_EXT_PICT_;
+  bool emoji = pictographic; // ExtPict Extend*
+  bool emoji_zwj = false;    // ExtPict Extend* ZWJ
+  int regional = previous == GB_RI_;
+  int w = (int)(props >> 4);
+  Ssize i = cr.size;
+
+  while (i < size) {
+    rest.data = p + i;
+    rest.size = size - i;
+    cr = UTF8View_get_codepoint(rest);
+    props = grapheme_props_(cr.codepoint);
+    const unsigned current = props & 15;
+
+    bool join;
+    if (previous == GB_CR_ && current == GB_LF_) join = true;                                 // GB3
+    else if (grapheme_is_control_(previous) || grapheme_is_control_(current)) join = false;  // GB4, GB5
+    else if (previous == GB_L_ && (current == GB_L_ || current == GB_V_ || current == GB_LV_ || current == GB_LVT_)) join = true;
+    else if ((previous == GB_LV_ || previous == GB_V_) && (current == GB_V_ || current == GB_T_)) join = true;
+    else if ((previous == GB_LVT_ || previous == GB_T_) && current == GB_T_) join = true;     // GB6-8
+    else if (current == GB_EXTEND_ || current == GB_ZWJ_ || current == GB_SPACING_MARK_) join = true; // GB9, GB9a
+    else if (previous == GB_PREPEND_) join = true;                                             // GB9b
+    else if (emoji_zwj && current == GB_EXT_PICT_) join = true;                                // GB11
+    else if (previous == GB_RI_ && current == GB_RI_) join = regional % 2 == 1;                // GB12, GB13
+    else join = false;                                                                         // GB999
+
+    if (!join) break;
+
+    emoji_zwj = emoji && current == GB_ZWJ_;
+    emoji = (current == GB_EXT_PICT_) || (emoji && current == GB_EXTEND_);
+    regional = (current == GB_RI_) ? regional + 1 : 0;
+    if ((int)(props >> 4) > w) w = (int)(props >> 4);
+    if (pictographic && cr.codepoint == 0xFE0F) w = 2;
+
+    previous = current;
+    i += cr.size;
   }
-  
-  return -1;
+
+  *width = w;
+  return i;
 }
 
-Ssize StrView_find_last_of(StrView s, StrView accept) {
-  uint8_t freq[256] = {0};
+// scan whole clusters while the width stays within max_width.
+// return the number of bytes scanned.
+static Ssize grapheme_scan_(UTF8View s8, Ssize max_width, Ssize *count, Ssize *width) {
+  Ssize i = 0;
+  Ssize n = 0;
+  Ssize w = 0;
 
-  for (Ssize i = 0; i < accept.size; ++i) {
-    freq[accept.data[i]]++;
-  }
-  
-  Ssize pos = s.size;
-  while (--pos >= 0) {
-    if (freq[s.data[pos]] != 0) break;
+  while (i < s8.size) {
+    Ssize run = grapheme_run_(s8.data + i, s8.size - i);
+    // the last printable byte may start a cluster with the next codepoints
+    if (run > 0 && i + run < s8.size && s8.data[i + run] >= 0x80) run--;
+    const bool full = run > max_width - w;
+    if (full) run = max_width - w;
+    n += run;
+    w += run;
+    i += run;
+    if (i == s8.size || full) break;
+
+    int cluster_width;
+    const Ssize size = grapheme_next_(s8.data + i, s8.size - i, &cluster_width);
+    if (w + cluster_width > max_width) break;
+    n++;
+    w += cluster_width;
+    i += size;
   }
-  
-  return pos;
+
+  *count = n;
+  *width = w;
+  return i;
 }
 
-Ssize StrView_find_last_not_of(StrView s, StrView reject) {
-  uint8_t freq[256] = {0};
+UTF8View UTF8View_get_grapheme(UTF8View s8) {
+  int width;
+  const UTF8View g = {s8.data, (s8.size > 0) ? grapheme_next_(s8.data, s8.size, &width) : 0};
 
-  for (Ssize i = 0; i < reject.size; ++i) {
-    freq[reject.data[i]]++;
-  }
-  
-  Ssize pos = s.size;
-  while (--pos >= 0) {
-    if (freq[s.data[pos]] == 0) break;
-  }
+  return g;
+}
 
-  return pos;
+Ssize UTF8View_count_grapheme(UTF8View s8) {
+  Ssize count;
+  Ssize width;
+
+  grapheme_scan_(s8, PTRDIFF_MAX, &count, &width);
+  return count;
+}
+
+Ssize UTF8View_width(UTF8View s8) {
+  Ssize count;
+  Ssize width;
+
+  grapheme_scan_(s8, PTRDIFF_MAX, &count, &width);
+  return width;
+}
+
+UTF8View UTF8View_truncate_width(UTF8View s8, Ssize width) {
+  Ssize count;
+  Ssize used;
+  const UTF8View prefix = {s8.data, grapheme_scan_(s8, width, &count, &used)};
+
+  return prefix;
 }
 
 #endif // STR_VIEW_IMPLEMENTATION
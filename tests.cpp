@@ -1,5 +1,16 @@
 #include <catch2/catch_test_macros.hpp>
+#include <stdlib.h>
+
+// allocation hook, a test sets a budget >= 0 to make later allocations fail.
+static long alloc_budget = -1;
+static void *budget_malloc(size_t size) {
+  if (alloc_budget == 0) return NULL;
+  if (alloc_budget > 0) alloc_budget--;
+  return malloc(size);
+}
 //
+#define STR_VIEW_MALLOC budget_malloc
+#define STR_VIEW_FREE   free
 #define STR_VIEW_IMPLEMENTATION
 #include "StrView.h"
 
@@ -462,3 +473,1089 @@ TEST_CASE("StrView_try_decode", "[StrView]") {
     }
   }
 }
+
+TEST_CASE("StrGlob_match", "[StrGlob]") {
+  struct {
+    const char *pattern;
+    const char *s;
+    bool match;
+  } cases[] = {
+    {"", "", true},
+    {"", "x", false},
+    {"*", "", true},
+    {"*", "FooBar", true},
+    {"Foo", "Foo", true},
+    {"Foo", "FooBar", false},
+    {"Foo*", "FooBar", true},
+    {"*Bar", "FooBar", true},
+    {"*Bar", "FooBaz", false},
+    {"F*o*r", "FooBar", true},
+    {"F?o*", "FooBar", true},
+    {"F??", "Fo", false},
+    {"/api/*/users/*", "/api/v1/users/42", true},
+    {"/api/*/users/*", "/api/v1/groups/42", false},
+    {"*a*a*a*a*b", "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", false},
+    {"[a-c]x", "bx", true},
+    {"[a-c]x", "dx", false},
+    {"[!a-c]x", "dx", true},
+    {"[^a-c]x", "ax", false},
+    {"[]]", "]", true},
+    {"*[0-9][0-9].log", "app-2022-09-10.log", true},
+    {"*[0-9][0-9].log", "app-2022-09-1x.log", false},
+    {"\\*", "*", true},
+    {"\\*", "x", false},
+    {"[*]?", "*x", true},
+    {"[abc", "[abc", true},
+    {"a*[xy]*[xy]b", "a-x-yb", true},
+    {"a*[xy]*[xy]b", "a-x-zb", false},
+  };
+
+  for (const auto &c : cases) {
+    StrGlob glob;
+    REQUIRE(StrGlob_compile(&glob, StrView_from_cstr(c.pattern)));
+    INFO("pattern: " << c.pattern << " s: " << c.s);
+    CHECK(StrGlob_match(&glob, StrView_from_cstr(c.s)) == c.match);
+    StrGlob_free(&glob);
+  }
+
+  SECTION("class segment longer than 64 bytes") {
+    char pattern[80 * 3 + 2] = "*";
+    char s[100];
+    for (int i = 0; i < 80; ++i) strcat(pattern, "[a]");
+    memset(s, 'a', sizeof(s));
+
+    StrGlob glob;
+    REQUIRE(StrGlob_compile(&glob, StrView_from_cstr(pattern)));
+    REQUIRE(StrGlob_match(&glob, StrView_from_raw(s, 80)));
+    REQUIRE(StrGlob_match(&glob, StrView_from_raw(s, 100)));
+    REQUIRE_FALSE(StrGlob_match(&glob, StrView_from_raw(s, 79)));
+    s[90] = 'b';
+    REQUIRE(StrGlob_match(&glob, StrView_from_raw(s, 90)));
+    REQUIRE_FALSE(StrGlob_match(&glob, StrView_from_raw(s, 91)));
+    StrGlob_free(&glob);
+  }
+}
+
+TEST_CASE("StrGlobSet_match", "[StrGlob]") {
+  const StrView patterns[] = {
+    StrView_from_cstr("/static/*"),
+    StrView_from_cstr("*.png"),
+    StrView_from_cstr("/api/v[0-9]/*"),
+    StrView_from_cstr("*"),
+  };
+  StrGlobSet set;
+  REQUIRE(StrGlobSet_compile(&set, patterns, 4));
+
+  SECTION("all matching globs") {
+    uint64_t matches[1];
+    REQUIRE(StrGlobSet_match(&set, StrView_from_cstr("/static/logo.png"), matches) == 3);
+    REQUIRE(matches[0] == 0xB);
+    REQUIRE(StrGlobSet_match(&set, StrView_from_cstr("/api/v2/users"), matches) == 2);
+    REQUIRE(matches[0] == 0xC);
+  }
+  SECTION("first matching glob") {
+    REQUIRE(StrGlobSet_find(&set, StrView_from_cstr("/img/logo.png")) == 1);
+    REQUIRE(StrGlobSet_find(&set, StrView_from_cstr("/index.html")) == 3);
+  }
+
+  StrGlobSet_free(&set);
+}
+
+TEST_CASE("StrGlobSet_match many globs", "[StrGlob]") {
+  // more globs than a find block, keyed by prefix, suffix, middle or none
+  enum { COUNT = 5000 };
+  static char texts[COUNT][32];
+  static StrView patterns[COUNT];
+  static StrGlob globs[COUNT];
+  static uint64_t matches[(COUNT + 63) / 64];
+  const char *formats[] = {
+    "/api/v%d/users/*", "*.ext%d", "*t%dx*", "/user/[0-9]*/item%d", "/exact/%d", "*?*b[0-9]*%d",
+  };
+  for (int i = 0; i < COUNT; ++i) {
+    if (i % 12 == 5) snprintf(texts[i], sizeof(texts[i]), "[a-c]?*");
+    else snprintf(texts[i], sizeof(texts[i]), formats[i % 6], i / 6);
+    patterns[i] = StrView_from_cstr(texts[i]);
+    REQUIRE(StrGlob_compile(&globs[i], patterns[i]));
+  }
+  StrGlobSet set;
+  REQUIRE(StrGlobSet_compile(&set, patterns, COUNT));
+
+  const char *inputs[] = {
+    "/api/v7/users/42", "/api/v800/users/", "/img/a.ext12", "/img/a.ext123", "at5xb", "zzt77xzz",
+    "/user/12/item3", "/user/x/item3", "/exact/9", "/exact/700", "/api/v700/users/x", "b1", "bb9c0",
+    "ab", "", "/", "/api/v7/users/t7x.ext7", "xb1234t1x", "c0b00000", "t1xt1xt1xt1x",
+  };
+  for (const char *input : inputs) {
+    const StrView s = StrView_from_cstr(input);
+    const Ssize count = StrGlobSet_match(&set, s, matches);
+    Ssize expected = 0;
+    Ssize first = -1;
+    int wrong = 0;
+    for (int i = 0; i < COUNT; ++i) {
+      const bool match = StrGlob_match(&globs[i], s);
+      wrong += match != (bool)((matches[i / 64] >> (i % 64)) & 1);
+      if (match && first < 0) first = i;
+      expected += match;
+    }
+
+    INFO(input);
+    CHECK(wrong == 0);
+    CHECK(count == expected);
+    CHECK(StrGlobSet_match(&set, s, NULL) == expected);
+    CHECK(StrGlobSet_find(&set, s) == first);
+  }
+
+  for (int i = 0; i < COUNT; ++i) StrGlob_free(&globs[i]);
+  StrGlobSet_free(&set);
+}
+
+TEST_CASE("StrPrefixSet", "[StrPrefixSet]") {
+  const StrView routes[] = {
+    StrView_from_cstr("/api/v1/users"),
+    StrView_from_cstr("/api/"),
+    StrView_from_cstr("/static/"),
+    StrView_from_cstr("/api/v1/"),
+    StrView_from_cstr("/"),
+    StrView_from_cstr("/api/v2/"),
+    StrView_from_cstr("/api/"),
+  };
+  StrPrefixSet set;
+  REQUIRE(StrPrefixSet_build(&set, routes, 7));
+
+  SECTION("longest matching prefix") {
+    Ssize size;
+    REQUIRE(StrPrefixSet_longest(&set, StrView_from_cstr("/api/v1/users/42"), &size) == 0);
+    REQUIRE(size == 13);
+    REQUIRE(StrPrefixSet_longest(&set, StrView_from_cstr("/api/v1/groups"), &size) == 3);
+    REQUIRE(size == 8);
+    REQUIRE(StrPrefixSet_longest(&set, StrView_from_cstr("/api/v3"), &size) == 1);
+    REQUIRE(StrPrefixSet_longest(&set, StrView_from_cstr("/index.html"), &size) == 4);
+    REQUIRE(size == 1);
+    REQUIRE(StrPrefixSet_longest(&set, StrView_from_cstr("api"), &size) < 0);
+    REQUIRE(size == 0);
+  }
+  SECTION("all matching prefixes") {
+    Ssize indexes[8];
+    REQUIRE(StrPrefixSet_all(&set, StrView_from_cstr("/api/v1/users"), indexes, 8) == 4);
+    REQUIRE(indexes[0] == 4);
+    REQUIRE(indexes[1] == 1);
+    REQUIRE(indexes[2] == 3);
+    REQUIRE(indexes[3] == 0);
+    REQUIRE(StrPrefixSet_all(&set, StrView_from_cstr("/api/v2"), indexes, 1) == 2);
+    REQUIRE(indexes[0] == 4);
+  }
+  SECTION("serialized form") {
+    StrView bytes = StrPrefixSet_bytes(&set);
+    uint8_t *copy = new uint8_t[bytes.size];
+    memcpy(copy, bytes.data, (size_t)bytes.size);
+
+    StrPrefixSet mapped;
+    REQUIRE(StrPrefixSet_from_bytes(&mapped, StrView_from_raw(copy, bytes.size)));
+    REQUIRE(mapped.count == 7);
+    REQUIRE(StrPrefixSet_longest(&mapped, StrView_from_cstr("/static/app.js"), NULL) == 2);
+    REQUIRE_FALSE(StrPrefixSet_from_bytes(&mapped, StrView_from_raw(copy, 8)));
+    StrPrefixSet_free(&mapped);
+    delete[] copy;
+  }
+  SECTION("empty set") {
+    StrPrefixSet empty;
+    REQUIRE(StrPrefixSet_build(&empty, NULL, 0));
+    REQUIRE(StrPrefixSet_longest(&empty, StrView_from_cstr("/"), NULL) < 0);
+    StrPrefixSet_free(&empty);
+  }
+  SECTION("deeply nested keys") {
+    // every key is a prefix of the next one, one node per key
+    enum { DEPTH = 10000 };
+    static uint8_t path[DEPTH];
+    static StrView keys[DEPTH];
+    for (int i = 0; i < DEPTH; ++i) {
+      path[i] = (uint8_t)"ab/"[i % 3];
+      keys[i] = StrView_from_raw(path, DEPTH - i);
+    }
+
+    StrPrefixSet deep;
+    REQUIRE(StrPrefixSet_build(&deep, keys, DEPTH));
+    Ssize size;
+    REQUIRE(StrPrefixSet_longest(&deep, StrView_from_raw(path, DEPTH), &size) == 0);
+    REQUIRE(size == DEPTH);
+    REQUIRE(StrPrefixSet_longest(&deep, StrView_from_raw(path, 100), &size) == DEPTH - 100);
+
+    Ssize indexes[4];
+    REQUIRE(StrPrefixSet_all(&deep, StrView_from_raw(path, 500), indexes, 4) == 500);
+    REQUIRE(indexes[0] == DEPTH - 1);
+    REQUIRE(indexes[3] == DEPTH - 4);
+    StrPrefixSet_free(&deep);
+  }
+
+  StrPrefixSet_free(&set);
+}
+
+TEST_CASE("StrCsv_next", "[StrCsv]") {
+  StrCsv csv;
+  StrView fields[8];
+  uint8_t scratch[256];
+
+  StrCsv_init(&csv, ',', '"');
+
+  SECTION("plain and quoted fields") {
+    StrCsv_feed(&csv, StrView_from_cstr("Foo,\"Bar,Baz\",\r\n,\"x\ny\"\nlast"), 1);
+
+    REQUIRE(StrCsv_next(&csv, fields, 8, scratch, sizeof(scratch)) == 3);
+    REQUIRE(StrView_is_equal(fields[0], StrView_from_cstr("Foo")));
+    REQUIRE(StrView_is_equal(fields[1], StrView_from_cstr("Bar,Baz")));
+    REQUIRE(StrView_is_equal(fields[2], StrView_from_cstr("")));
+
+    REQUIRE(StrCsv_next(&csv, fields, 8, scratch, sizeof(scratch)) == 2);
+    REQUIRE(StrView_is_equal(fields[0], StrView_from_cstr("")));
+    REQUIRE(StrView_is_equal(fields[1], StrView_from_cstr("x\ny")));
+
+    REQUIRE(StrCsv_next(&csv, fields, 8, scratch, sizeof(scratch)) == 1);
+    REQUIRE(StrView_is_equal(fields[0], StrView_from_cstr("last")));
+    REQUIRE(StrCsv_next(&csv, fields, 8, scratch, sizeof(scratch)) == 0);
+  }
+  SECTION("doubled quotes are unescaped in scratch") {
+    StrCsv_feed(&csv, StrView_from_cstr("\"say \"\"hi\"\"\",x\n"), 1);
+
+    REQUIRE(StrCsv_next(&csv, fields, 8, scratch, 4) == -1);
+    REQUIRE(StrCsv_next(&csv, fields, 8, scratch, sizeof(scratch)) == 2);
+    REQUIRE(StrView_is_equal(fields[0], StrView_from_cstr("say \"hi\"")));
+    REQUIRE(fields[0].data == scratch);
+    REQUIRE(StrView_is_equal(fields[1], StrView_from_cstr("x")));
+  }
+  SECTION("records across 64 bytes blocks") {
+    const char *row = "0123456789,\"quoted, with \"\"comma\"\"\",abcdefghijklmnopqrstuvwxyz\n";
+    char input[2048] = "";
+    for (int i = 0; i < 20; ++i) strcat(input, row);
+    StrCsv_feed(&csv, StrView_from_cstr(input), 1);
+
+    for (int i = 0; i < 20; ++i) {
+      REQUIRE(StrCsv_next(&csv, fields, 8, scratch, sizeof(scratch)) == 3);
+      REQUIRE(StrView_is_equal(fields[1], StrView_from_cstr("quoted, with \"comma\"")));
+      REQUIRE(StrView_is_equal(fields[2], StrView_from_cstr("abcdefghijklmnopqrstuvwxyz")));
+    }
+    REQUIRE(StrCsv_next(&csv, fields, 8, scratch, sizeof(scratch)) == 0);
+  }
+  SECTION("resume across chunks") {
+    const char *input = "a,\"b\nc\"\nd,e\n";
+    char chunk[64];
+
+    // cut inside the quoted field
+    StrCsv_feed(&csv, StrView_from_raw(input, 4), 0);
+    REQUIRE(StrCsv_next(&csv, fields, 8, scratch, sizeof(scratch)) == 0);
+    StrView rest = StrCsv_rest(&csv);
+    REQUIRE(StrView_is_equal(rest, StrView_from_cstr("a,\"b")));
+
+    memcpy(chunk, rest.data, (size_t)rest.size);
+    memcpy(chunk + rest.size, input + 4, strlen(input) - 4);
+    StrCsv_feed(&csv, StrView_from_raw(chunk, rest.size + (Ssize)strlen(input) - 4), 1);
+    REQUIRE(StrCsv_next(&csv, fields, 8, scratch, sizeof(scratch)) == 2);
+    REQUIRE(StrView_is_equal(fields[1], StrView_from_cstr("b\nc")));
+    REQUIRE(StrCsv_next(&csv, fields, 8, scratch, sizeof(scratch)) == 2);
+    REQUIRE(StrView_is_equal(fields[0], StrView_from_cstr("d")));
+    REQUIRE(StrCsv_next(&csv, fields, 8, scratch, sizeof(scratch)) == 0);
+    REQUIRE(StrCsv_rest(&csv).size == 0);
+  }
+  SECTION("long quoted field in small chunks") {
+    // "x...x" of 1000 bytes, then ",end\n", fed 10 bytes at a time
+    char input[1008];
+    char chunk[1024];
+    input[0] = '"';
+    memset(input + 1, 'x', 1000);
+    memcpy(input + 1001, "\",end\n", 6);
+    const Ssize size = sizeof(input) - 1;
+    Ssize count = 0;
+
+    for (Ssize at = 0; at < size; at += 10) {
+      const Ssize step = (size - at < 10) ? size - at : 10;
+      const StrView rest = StrCsv_rest(&csv);
+      if (rest.size > 0) memmove(chunk, rest.data, (size_t)rest.size);
+      memcpy(chunk + rest.size, input + at, (size_t)step);
+      StrCsv_feed(&csv, StrView_from_raw(chunk, rest.size + step), at + step == size);
+      count = StrCsv_next(&csv, fields, 8, scratch, sizeof(scratch));
+      // the bytes of an incomplete record are not scanned again
+      if (count == 0) REQUIRE(csv.scanned == rest.size + step);
+    }
+    REQUIRE(count == 2);
+    REQUIRE(fields[0].size == 1000);
+    REQUIRE(StrView_is_equal(fields[1], StrView_from_cstr("end")));
+  }
+  SECTION("tsv") {
+    StrCsv_init(&csv, '\t', '"');
+    StrCsv_feed(&csv, StrView_from_cstr("a,b\tc\n"), 1);
+    REQUIRE(StrCsv_next(&csv, fields, 1, scratch, sizeof(scratch)) == 2);
+    REQUIRE(StrView_is_equal(fields[0], StrView_from_cstr("a,b")));
+  }
+}
+
+TEST_CASE("StrView_escape", "[StrView]") {
+  uint8_t out[256];
+
+  SECTION("nothing to escape is zero copy") {
+    StrView s = StrView_from_cstr("plain text with utf8 \xC3\xA9t\xC3\xA9 and more than 32 bytes");
+    StrView escaped = StrView_escape(s, STR_ESCAPE_JSON, out, sizeof(out));
+    REQUIRE(escaped.data == s.data);
+    REQUIRE(escaped.size == s.size);
+    REQUIRE(StrView_escape_size(s, STR_ESCAPE_JSON) == s.size);
+  }
+  SECTION("json escapes") {
+    StrView s = StrView_from_cstr("a \"quoted\" \\ path\n\x01 long enough to use the vector path\x7F");
+    const char *expected = "a \\\"quoted\\\" \\\\ path\\n\\u0001 long enough to use the vector path\x7F";
+    StrView escaped = StrView_escape(s, STR_ESCAPE_JSON, out, sizeof(out));
+    REQUIRE(StrView_is_equal(escaped, StrView_from_cstr(expected)));
+    REQUIRE(StrView_escape_size(s, STR_ESCAPE_JSON) == escaped.size);
+  }
+  SECTION("invalid utf8") {
+    StrView s = StrView_from_cstr("x\xC3(\xFF");
+    REQUIRE(StrView_is_equal(StrView_escape(s, STR_ESCAPE_JSON, out, sizeof(out)),
+                             StrView_from_cstr("x\\ufffd(\\ufffd")));
+    REQUIRE(StrView_is_equal(StrView_escape(s, STR_ESCAPE_C, out, sizeof(out)),
+                             StrView_from_cstr("x\\303(\\377")));
+  }
+  SECTION("cut short utf8") {
+    StrView s = StrView_from_cstr("ab\xE2" "c");
+    REQUIRE(StrView_is_equal(StrView_escape(s, STR_ESCAPE_JSON, out, sizeof(out)),
+                             StrView_from_cstr("ab\\ufffdc")));
+    REQUIRE(StrView_escape_size(s, STR_ESCAPE_JSON) == 9);
+    s = StrView_from_cstr("x\xF0\x9F\"");
+    REQUIRE(StrView_is_equal(StrView_escape(s, STR_ESCAPE_JSON, out, sizeof(out)),
+                             StrView_from_cstr("x\\ufffd\\\"")));
+    REQUIRE(StrView_escape_size(s, STR_ESCAPE_JSON) == 9);
+  }
+  SECTION("c escapes") {
+    StrView s = StrView_from_cstr("\a\t\"\x1B");
+    REQUIRE(StrView_is_equal(StrView_escape(s, STR_ESCAPE_C, out, sizeof(out)),
+                             StrView_from_cstr("\\a\\t\\\"\\033")));
+  }
+  SECTION("out too small") {
+    StrView s = StrView_from_cstr("\n\n");
+    StrView escaped = StrView_escape(s, STR_ESCAPE_JSON, out, 3);
+    REQUIRE(escaped.data == NULL);
+    REQUIRE(escaped.size == -4);
+  }
+}
+
+TEST_CASE("StrView_unescape", "[StrView]") {
+  uint8_t out[256];
+
+  SECTION("nothing to unescape is zero copy") {
+    StrView s = StrView_from_cstr("plain text \xC3\xA9t\xC3\xA9");
+    StrView unescaped = StrView_unescape(s, STR_ESCAPE_JSON, out, sizeof(out));
+    REQUIRE(unescaped.data == s.data);
+    REQUIRE(unescaped.size == s.size);
+  }
+  SECTION("json escapes and surrogate pairs") {
+    StrView s = StrView_from_cstr("a\\\"b\\\\c\\/\\n\\u00e9\\ud83d\\ude00 more than thirty two bytes");
+    StrView unescaped = StrView_unescape(s, STR_ESCAPE_JSON, out, sizeof(out));
+    const char *expected = "a\"b\\c/\n\xC3\xA9\xF0\x9F\x98\x80 more than thirty two bytes";
+    REQUIRE(StrView_is_equal(unescaped, StrView_from_cstr(expected)));
+  }
+  SECTION("json errors give the offset") {
+    REQUIRE(StrView_unescape(StrView_from_cstr("ab\\q"), STR_ESCAPE_JSON, out, sizeof(out)).size == -3);
+    REQUIRE(StrView_unescape(StrView_from_cstr("\\ud83d"), STR_ESCAPE_JSON, out, sizeof(out)).size == -1);
+    REQUIRE(StrView_unescape(StrView_from_cstr("\\ude00"), STR_ESCAPE_JSON, out, sizeof(out)).size == -1);
+    REQUIRE(StrView_unescape(StrView_from_cstr("\\u12"), STR_ESCAPE_JSON, out, sizeof(out)).size == -1);
+    REQUIRE(StrView_unescape(StrView_from_cstr("a\tb"), STR_ESCAPE_JSON, out, sizeof(out)).size == -2);
+    REQUIRE(StrView_unescape(StrView_from_cstr("ok\xC3("), STR_ESCAPE_JSON, out, sizeof(out)).data == NULL);
+  }
+  SECTION("out too small") {
+    StrView s = StrView_from_cstr("ab\\n");
+    StrView unescaped = StrView_unescape(s, STR_ESCAPE_JSON, out, 3);
+    REQUIRE(unescaped.data == NULL);
+    REQUIRE(unescaped.size == -1 - s.size);
+    REQUIRE(StrView_unescape(StrView_from_cstr("ab\\"), STR_ESCAPE_JSON, out, 3).size == -3);
+    REQUIRE(StrView_is_equal(StrView_unescape(s, STR_ESCAPE_JSON, out, 4), StrView_from_cstr("ab\n")));
+  }
+  SECTION("c escapes") {
+    StrView s = StrView_from_cstr("\\a\\x41\\101\\0\\U0001F600\\?");
+    StrView unescaped = StrView_unescape(s, STR_ESCAPE_C, out, sizeof(out));
+    const uint8_t expected[] = {'\a', 'A', 'A', 0, 0xF0, 0x9F, 0x98, 0x80, '?'};
+    REQUIRE(StrView_is_equal(unescaped, StrView_from_raw(expected, sizeof(expected))));
+    REQUIRE(StrView_unescape(StrView_from_cstr("\\x100"), STR_ESCAPE_C, out, sizeof(out)).size == -1);
+    REQUIRE(StrView_unescape(StrView_from_cstr("a\\UFFFFFFFF"), STR_ESCAPE_C, out, sizeof(out)).size == -2);
+    REQUIRE(StrView_unescape(StrView_from_cstr("a\\U80000000"), STR_ESCAPE_C, out, sizeof(out)).size == -2);
+    REQUIRE(StrView_unescape(StrView_from_cstr("a\\U00110000"), STR_ESCAPE_C, out, sizeof(out)).size == -2);
+    REQUIRE(StrView_unescape(StrView_from_cstr("a\\U0000D800"), STR_ESCAPE_C, out, sizeof(out)).size == -2);
+    REQUIRE(StrView_is_equal(StrView_unescape(StrView_from_cstr("\\U0010FFFF"), STR_ESCAPE_C, out, sizeof(out)),
+                             StrView_from_cstr("\xF4\x8F\xBF\xBF")));
+  }
+  SECTION("round trip") {
+    const uint8_t raw[] = {'"', 0, 0x1F, '\\', 0xC3, 0xA9, 'x'};
+    StrView s = StrView_from_raw(raw, sizeof(raw));
+    uint8_t back[256];
+    StrView json = StrView_escape(s, STR_ESCAPE_JSON, out, sizeof(out));
+    REQUIRE(StrView_is_equal(StrView_unescape(json, STR_ESCAPE_JSON, back, sizeof(back)), s));
+    StrView c = StrView_escape(s, STR_ESCAPE_C, out, sizeof(out));
+    REQUIRE(StrView_is_equal(StrView_unescape(c, STR_ESCAPE_C, back, sizeof(back)), s));
+  }
+}
+
+TEST_CASE("StrView_hex", "[StrView]") {
+  uint8_t out[256];
+  uint8_t back[256];
+
+  SECTION("encode") {
+    const uint8_t raw[] = {0x00, 0x7F, 0xAB, 0xFF};
+    StrView hex = StrView_hex_encode(StrView_from_raw(raw, sizeof(raw)), out, sizeof(out));
+    REQUIRE(StrView_is_equal(hex, StrView_from_cstr("007fabff")));
+  }
+  SECTION("round trip over vector blocks") {
+    uint8_t raw[100];
+    for (int i = 0; i < 100; ++i) raw[i] = (uint8_t)(i * 37);
+    StrView s = StrView_from_raw(raw, sizeof(raw));
+    StrView hex = StrView_hex_encode(s, out, sizeof(out));
+    REQUIRE(hex.size == StrView_hex_encode_size(s));
+    REQUIRE(StrView_is_equal(StrView_hex_decode(hex, back, sizeof(back)), s));
+  }
+  SECTION("decode any case") {
+    const uint8_t raw[] = {0xDE, 0xAD, 0xBE, 0xEF};
+    REQUIRE(StrView_is_equal(StrView_hex_decode(StrView_from_cstr("DeadBEEF"), out, sizeof(out)),
+                             StrView_from_raw(raw, sizeof(raw))));
+  }
+  SECTION("decode errors give the offset") {
+    REQUIRE(StrView_hex_decode(StrView_from_cstr("0g"), out, sizeof(out)).size == -2);
+    REQUIRE(StrView_hex_decode(StrView_from_cstr("abc"), out, sizeof(out)).size == -3);
+    REQUIRE(StrView_hex_decode(StrView_from_cstr("00112233445566778899aabbccddeeff00112233445566778899aabbccddeefx"),
+                               out, sizeof(out)).size == -64);
+  }
+}
+
+TEST_CASE("StrView_base64", "[StrView]") {
+  uint8_t out[256];
+
+  SECTION("rfc 4648 vectors") {
+    const char *vectors[][2] = {
+      {"", ""}, {"f", "Zg=="}, {"fo", "Zm8="}, {"foo", "Zm9v"},
+      {"foob", "Zm9vYg=="}, {"fooba", "Zm9vYmE="}, {"foobar", "Zm9vYmFy"},
+    };
+    for (const auto &v : vectors) {
+      StrView s = StrView_from_cstr(v[0]);
+      REQUIRE(StrView_base64_encode_size(s, STR_BASE64_STD) == (Ssize)strlen(v[1]));
+      REQUIRE(StrView_is_equal(StrView_base64_encode(s, STR_BASE64_STD, out, sizeof(out)), StrView_from_cstr(v[1])));
+      REQUIRE(StrView_base64_decode_size(StrView_from_cstr(v[1]), STR_BASE64_STD) == s.size);
+      REQUIRE(StrView_is_equal(StrView_base64_decode(StrView_from_cstr(v[1]), STR_BASE64_STD, out, sizeof(out)), s));
+    }
+  }
+  SECTION("url alphabet without padding") {
+    const uint8_t raw[] = {0xFB, 0xFF, 0xBF};
+    StrView s = StrView_from_raw(raw, sizeof(raw));
+    REQUIRE(StrView_is_equal(StrView_base64_encode(s, STR_BASE64_STD, out, sizeof(out)), StrView_from_cstr("+/+/")));
+    REQUIRE(StrView_is_equal(StrView_base64_encode(s, STR_BASE64_URL, out, sizeof(out)), StrView_from_cstr("-_-_")));
+
+    const int flags = STR_BASE64_URL | STR_BASE64_NOPAD;
+    REQUIRE(StrView_is_equal(StrView_base64_encode(StrView_from_cstr("fo"), flags, out, sizeof(out)), StrView_from_cstr("Zm8")));
+    REQUIRE(StrView_is_equal(StrView_base64_decode(StrView_from_cstr("Zm8"), flags, out, sizeof(out)), StrView_from_cstr("fo")));
+  }
+  SECTION("round trip over vector blocks") {
+    uint8_t raw[150];
+    uint8_t back[150];
+    for (int i = 0; i < 150; ++i) raw[i] = (uint8_t)(i * 97 + 11);
+    StrView s = StrView_from_raw(raw, sizeof(raw));
+    for (int flags = 0; flags < 4; ++flags) {
+      StrView text = StrView_base64_encode(s, flags, out, sizeof(out));
+      REQUIRE(StrView_is_equal(StrView_base64_decode(text, flags, back, sizeof(back)), s));
+    }
+  }
+  SECTION("decode errors give the offset") {
+    REQUIRE(StrView_base64_decode(StrView_from_cstr("Zm9"), STR_BASE64_STD, out, sizeof(out)).size == -1);
+    REQUIRE(StrView_base64_decode(StrView_from_cstr("Zm=v"), STR_BASE64_STD, out, sizeof(out)).size == -3);
+    REQUIRE(StrView_base64_decode(StrView_from_cstr("Zm8="), STR_BASE64_NOPAD, out, sizeof(out)).size == -4);
+    REQUIRE(StrView_base64_decode(StrView_from_cstr("Zm9="), STR_BASE64_STD, out, sizeof(out)).size == -3);
+    REQUIRE(StrView_base64_decode(StrView_from_cstr("-_-_"), STR_BASE64_STD, out, sizeof(out)).size == -1);
+    REQUIRE(StrView_base64_decode(StrView_from_cstr("QUJDREVGR0hJSktMTU5PUFFSU1RVVldYWVphYmNk ZWZ"),
+                                  STR_BASE64_STD, out, sizeof(out)).size == -41);
+  }
+}
+
+TEST_CASE("StrView_edit_distance", "[StrView]") {
+  SECTION("bytes") {
+    REQUIRE(StrView_edit_distance(StrView_from_cstr(""), StrView_from_cstr("")) == 0);
+    REQUIRE(StrView_edit_distance(StrView_from_cstr(""), StrView_from_cstr("Foo")) == 3);
+    REQUIRE(StrView_edit_distance(StrView_from_cstr("kitten"), StrView_from_cstr("sitting")) == 3);
+    REQUIRE(StrView_edit_distance(StrView_from_cstr("flaw"), StrView_from_cstr("lawn")) == 2);
+  }
+  SECTION("patterns longer than 64 bytes") {
+    char s1[200];
+    char s2[200];
+    memset(s1, 'a', sizeof(s1));
+    memset(s2, 'a', sizeof(s2));
+    s2[10] = 'b';
+    s2[150] = 'c';
+    REQUIRE(StrView_edit_distance(StrView_from_raw(s1, 200), StrView_from_raw(s2, 200)) == 2);
+    REQUIRE(StrView_edit_distance(StrView_from_raw(s1, 130), StrView_from_raw(s2, 200)) == 70);
+  }
+  SECTION("bounded") {
+    StrView kitten = StrView_from_cstr("kitten");
+    StrView sitting = StrView_from_cstr("sitting");
+    REQUIRE(StrView_edit_distance_max(kitten, sitting, 3) == 3);
+    REQUIRE(StrView_edit_distance_max(kitten, sitting, 2) < 0);
+    REQUIRE(StrView_edit_distance_max(kitten, StrView_from_cstr("kitten and more"), 5) < 0);
+  }
+  SECTION("codepoints") {
+    UTF8View cafe = UTF8View_from_strview(StrView_from_cstr("caf\xC3\xA9"));
+    UTF8View cafes = UTF8View_from_strview(StrView_from_cstr("caf\xC3\xA8s"));
+    REQUIRE(StrView_edit_distance(StrView_cast(cafe), StrView_cast(cafes)) == 2);
+    REQUIRE(UTF8View_edit_distance(cafe, cafes) == 2);
+    REQUIRE(UTF8View_edit_distance(cafe, UTF8View_from_strview(StrView_from_cstr("cafe"))) == 1);
+    REQUIRE(UTF8View_edit_distance_max(cafe, cafes, 1) < 0);
+  }
+}
+
+TEST_CASE("StrView_find_approx", "[StrView]") {
+  StrView s = StrView_from_cstr("the quick brown fox jumps over the lazy dog");
+  Ssize size;
+
+  SECTION("exact match") {
+    REQUIRE(StrView_find_approx(s, StrView_from_cstr("brown"), 0, &size) == 10);
+    REQUIRE(size == 5);
+  }
+  SECTION("with errors") {
+    REQUIRE(StrView_find_approx(s, StrView_from_cstr("jumsp"), 0, &size) < 0);
+    REQUIRE(StrView_find_approx(s, StrView_from_cstr("jumsp"), 1, &size) == 20);
+    REQUIRE(StrView_find_approx(s, StrView_from_cstr("lazzy"), 1, &size) == 35);
+    REQUIRE(size == 4);
+  }
+  SECTION("no match") {
+    REQUIRE(StrView_find_approx(s, StrView_from_cstr("xyzzy"), 2, NULL) < 0);
+  }
+}
+
+TEST_CASE("UTF8View_quick_check", "[UTF8View]") {
+  Ssize offset;
+
+  SECTION("ascii and precomposed") {
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("plain ascii text that is long enough for simd caf\xC3\xA9"));
+    REQUIRE(UTF8View_quick_check(s8, STR_NFC, &offset) == STR_QC_YES);
+    REQUIRE(offset == s8.size);
+    REQUIRE(UTF8View_quick_check(s8, STR_NFD, &offset) == STR_QC_NO);
+    REQUIRE(offset == s8.size - 2);
+  }
+  SECTION("combining marks") {
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("cafe\xCC\x81"));
+    REQUIRE(UTF8View_quick_check(s8, STR_NFC, &offset) == STR_QC_MAYBE);
+    REQUIRE(offset == 4);
+    REQUIRE(UTF8View_quick_check(s8, STR_NFD, NULL) == STR_QC_YES);
+  }
+  SECTION("misordered marks") {
+    // U+0301 (ccc 230) before U+0323 (ccc 220)
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("a\xCC\x81\xCC\xA3"));
+    REQUIRE(UTF8View_quick_check(s8, STR_NFD, &offset) == STR_QC_NO);
+    REQUIRE(offset == 3);
+  }
+}
+
+TEST_CASE("UTF8View_normalize", "[UTF8View]") {
+  uint8_t out[64];
+
+  SECTION("already normalized") {
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("caf\xC3\xA9"));
+    UTF8View n = UTF8View_normalize(s8, STR_NFC, out, sizeof(out));
+    REQUIRE(n.data == s8.data);
+    REQUIRE(n.size == s8.size);
+  }
+  SECTION("compose and decompose") {
+    UTF8View nfd = UTF8View_from_strview(StrView_from_cstr("cafe\xCC\x81"));
+    UTF8View nfc = UTF8View_from_strview(StrView_from_cstr("caf\xC3\xA9"));
+    REQUIRE(StrView_is_equal(StrView_cast(UTF8View_normalize(nfd, STR_NFC, out, sizeof(out))), StrView_cast(nfc)));
+    REQUIRE(StrView_is_equal(StrView_cast(UTF8View_normalize(nfc, STR_NFD, out, sizeof(out))), StrView_cast(nfd)));
+  }
+  SECTION("reorder marks") {
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("a\xCC\x81\xCC\xA3"));
+    // U+1EA1 U+0301
+    REQUIRE(StrView_is_equal(StrView_cast(UTF8View_normalize(s8, STR_NFC, out, sizeof(out))),
+                              StrView_from_cstr("\xE1\xBA\xA1\xCC\x81")));
+    REQUIRE(StrView_is_equal(StrView_cast(UTF8View_normalize(s8, STR_NFD, out, sizeof(out))),
+                              StrView_from_cstr("a\xCC\xA3\xCC\x81")));
+  }
+  SECTION("hangul") {
+    // U+D55C <-> U+1112 U+1161 U+11AB
+    UTF8View syllable = UTF8View_from_strview(StrView_from_cstr("\xED\x95\x9C"));
+    UTF8View jamo = UTF8View_from_strview(StrView_from_cstr("\xE1\x84\x92\xE1\x85\xA1\xE1\x86\xAB"));
+    REQUIRE(StrView_is_equal(StrView_cast(UTF8View_normalize(syllable, STR_NFD, out, sizeof(out))), StrView_cast(jamo)));
+    REQUIRE(StrView_is_equal(StrView_cast(UTF8View_normalize(jamo, STR_NFC, out, sizeof(out))), StrView_cast(syllable)));
+  }
+  SECTION("maybe but normalized is zero copy") {
+    // U+0301 is a maybe for NFC, nothing composes with x
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("x\xCC\x81"));
+    REQUIRE(UTF8View_quick_check(s8, STR_NFC, NULL) == STR_QC_MAYBE);
+    UTF8View n = UTF8View_normalize(s8, STR_NFC, out, 1);
+    REQUIRE(n.data == s8.data);
+    REQUIRE(n.size == s8.size);
+  }
+  SECTION("stream safe") {
+    // a and 40 U+0316, a CGJ is inserted after 30 marks
+    uint8_t s[1 + 2 * 40];
+    uint8_t expected[1 + 2 * 40 + 2];
+    uint8_t large[128];
+    s[0] = expected[0] = 'a';
+    for (int i = 0; i < 40; ++i) memcpy(s + 1 + 2 * i, "\xCC\x96", 2);
+    memcpy(expected + 1, s + 1, 2 * 30);
+    memcpy(expected + 1 + 2 * 30, "\xCD\x8F", 2);
+    memcpy(expected + 3 + 2 * 30, s + 1, 2 * 10);
+    UTF8View s8 = {s, sizeof(s)};
+    REQUIRE(StrView_is_equal(StrView_cast(UTF8View_normalize(s8, STR_NFC, large, sizeof(large))),
+                             StrView_from_raw(expected, sizeof(expected))));
+    REQUIRE(StrView_is_equal(StrView_cast(UTF8View_normalize(s8, STR_NFD, large, sizeof(large))),
+                             StrView_from_raw(expected, sizeof(expected))));
+    s8.size = 1 + 2 * 30;
+    REQUIRE(UTF8View_normalize(s8, STR_NFC, large, sizeof(large)).data == s);
+  }
+  SECTION("buffer too small") {
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("caf\xC3\xA9"));
+    UTF8View n = UTF8View_normalize(s8, STR_NFD, out, 4);
+    REQUIRE(n.data == NULL);
+    REQUIRE(n.size == -6);
+  }
+}
+
+TEST_CASE("StrBuilder_append", "[StrBuilder]") {
+  StrBuilder b;
+
+  SECTION("stack buffer") {
+    uint8_t buffer[16];
+    StrBuilder_init(&b, buffer, sizeof(buffer));
+    REQUIRE(StrBuilder_append(&b, StrView_from_cstr("id=")));
+    REQUIRE(StrBuilder_append_int(&b, -42));
+    REQUIRE(StrBuilder_append_byte(&b, ' '));
+    REQUIRE(StrBuilder_append_codepoint(&b, 0xE9));
+    StrView s = StrBuilder_view(&b);
+    REQUIRE(s.data == buffer);
+    REQUIRE(StrView_is_equal(s, StrView_from_cstr("id=-42 \xC3\xA9")));
+    StrBuilder_free(&b);
+  }
+  SECTION("many chunks") {
+    StrBuilder_init(&b, NULL, 0);
+    Ssize expected = 0;
+    for (int i = 0; i < 1000; ++i) {
+      REQUIRE(StrBuilder_append_uint(&b, (uint64_t)i * 7919));
+      REQUIRE(StrBuilder_append(&b, StrView_from_cstr(", ")));
+      for (int n = i * 7919; n >= 10; n /= 10) expected++;
+      expected += 3;
+    }
+    REQUIRE(StrBuilder_size(&b) == expected);
+    StrView s = StrBuilder_view(&b);
+    REQUIRE(s.size == expected);
+    REQUIRE(StrView_starts_with(s, StrView_from_cstr("0, 7919, 15838, ")));
+    REQUIRE(StrView_ends_with(s, StrView_from_cstr(", 7903162, 7911081, ")));
+    REQUIRE(StrBuilder_append(&b, StrView_from_cstr("end")));
+    s = StrBuilder_view(&b);
+    REQUIRE(s.size == expected + 3);
+    REQUIRE(StrView_ends_with(s, StrView_from_cstr("7911081, end")));
+    StrBuilder_clear(&b);
+    REQUIRE(StrBuilder_size(&b) == 0);
+    REQUIRE(StrBuilder_reserve(&b, 100));
+    StrBuilder_free(&b);
+  }
+  SECTION("integer limits") {
+    StrBuilder_init(&b, NULL, 0);
+    REQUIRE(StrBuilder_append_int(&b, INT64_MIN));
+    REQUIRE(StrBuilder_append_byte(&b, ' '));
+    REQUIRE(StrBuilder_append_uint(&b, UINT64_MAX));
+    REQUIRE(StrBuilder_append_byte(&b, ' '));
+    REQUIRE(StrBuilder_append_int(&b, 0));
+    REQUIRE(StrView_is_equal(StrBuilder_view(&b),
+                             StrView_from_cstr("-9223372036854775808 18446744073709551615 0")));
+    StrBuilder_free(&b);
+  }
+  SECTION("invalid codepoint") {
+    StrBuilder_init(&b, NULL, 0);
+    REQUIRE_FALSE(StrBuilder_append_codepoint(&b, 0xD800));
+    REQUIRE(StrView_is_equal(StrBuilder_view(&b), StrView_from_cstr("\xEF\xBF\xBD")));
+    StrBuilder_free(&b);
+  }
+}
+
+TEST_CASE("StrBuilder_join", "[StrBuilder]") {
+  StrBuilder b;
+  StrBuilder_init(&b, NULL, 0);
+  StrView views[] = {StrView_from_cstr("a"), StrView_from_cstr(""), StrView_from_cstr("bc")};
+
+  REQUIRE(StrBuilder_join(&b, views, 3, StrView_from_cstr(", ")));
+  REQUIRE(StrView_is_equal(StrBuilder_view(&b), StrView_from_cstr("a, , bc")));
+  REQUIRE(StrBuilder_join(&b, views, 0, StrView_from_cstr(", ")));
+  REQUIRE(StrBuilder_size(&b) == 7);
+  StrBuilder_free(&b);
+}
+
+TEST_CASE("StrBuilder_replace_all", "[StrBuilder]") {
+  StrBuilder b;
+  StrBuilder_init(&b, NULL, 0);
+
+  SECTION("replace") {
+    REQUIRE(StrBuilder_replace_all(&b, StrView_from_cstr("a-b--c-"), StrView_from_cstr("-"), StrView_from_cstr("::")) == 4);
+    REQUIRE(StrView_is_equal(StrBuilder_view(&b), StrView_from_cstr("a::b::::c::")));
+  }
+  SECTION("shorter replacement") {
+    REQUIRE(StrBuilder_replace_all(&b, StrView_from_cstr("a::b::::c"), StrView_from_cstr("::"), StrView_from_cstr("-")) == 3);
+    REQUIRE(StrView_is_equal(StrBuilder_view(&b), StrView_from_cstr("a-b--c")));
+  }
+  SECTION("longer replacement grows the builder") {
+    char s[4 * 100];
+    char expected[9 * 100];
+    for (int i = 0; i < 100; ++i) memcpy(s + 4 * i, "ab-,", 4);
+    for (int i = 0; i < 100; ++i) memcpy(expected + 9 * i, "ab<dash>,", 9);
+    REQUIRE(StrBuilder_replace_all(&b, StrView_from_raw((const uint8_t*)s, sizeof(s)), StrView_from_cstr("-"),
+                                   StrView_from_cstr("<dash>")) == 100);
+    REQUIRE(StrView_is_equal(StrBuilder_view(&b), StrView_from_raw((const uint8_t*)expected, sizeof(expected))));
+  }
+  SECTION("failed reserve keeps size and contents") {
+    uint8_t buffer[8];
+    StrBuilder_init(&b, buffer, sizeof(buffer));
+    REQUIRE(StrBuilder_append(&b, StrView_from_cstr("hello")));
+    alloc_budget = 0;
+    REQUIRE_FALSE(StrBuilder_reserve(&b, 100));
+    alloc_budget = -1;
+    REQUIRE(StrBuilder_size(&b) == 5);
+    REQUIRE(memcmp(buffer, "hello", 5) == 0);
+    REQUIRE(StrBuilder_view(&b).data == NULL);
+  }
+  SECTION("failed replace reserve keeps size and contents") {
+    uint8_t buffer[8];
+    StrBuilder_init(&b, buffer, sizeof(buffer));
+    REQUIRE(StrBuilder_append(&b, StrView_from_cstr("hello")));
+    alloc_budget = 0;
+    REQUIRE(StrBuilder_replace_all(&b, StrView_from_cstr("a--b--c--d"), StrView_from_cstr("--"), StrView_from_cstr("-")) == -1);
+    alloc_budget = -1;
+    REQUIRE(StrBuilder_size(&b) == 5);
+    REQUIRE(memcmp(buffer, "hello", 5) == 0);
+  }
+  StrBuilder_free(&b);
+}
+
+TEST_CASE("StrDict", "[StrDict]") {
+  const char *words[] = {"banana", "apple", "application", "apply", "band", "bandana", "cherry", "apple"};
+  StrView keys[8];
+  for (int i = 0; i < 8; ++i) keys[i] = StrView_from_cstr(words[i]);
+
+  StrDict built;
+  REQUIRE(StrDict_build(&built, keys, 8));
+  REQUIRE(built.count == 7);
+  REQUIRE(built.max_key_size == 11);
+
+  StrDict dict;
+  REQUIRE(StrDict_from_bytes(&dict, StrDict_bytes(&built)));
+  REQUIRE(dict.count == 7);
+  uint8_t out[16];
+
+  SECTION("get by id") {
+    REQUIRE(StrView_is_equal(StrDict_get(&dict, 0, out, sizeof(out)), StrView_from_cstr("apple")));
+    REQUIRE(StrView_is_equal(StrDict_get(&dict, 1, out, sizeof(out)), StrView_from_cstr("application")));
+    REQUIRE(StrView_is_equal(StrDict_get(&dict, 6, out, sizeof(out)), StrView_from_cstr("cherry")));
+    StrView too_small = StrDict_get(&dict, 1, out, 4);
+    REQUIRE(too_small.data == NULL);
+    REQUIRE(too_small.size == -11);
+  }
+  SECTION("find") {
+    REQUIRE(StrDict_find(&dict, StrView_from_cstr("apply")) == 2);
+    REQUIRE(StrDict_find(&dict, StrView_from_cstr("bandana")) == 5);
+    REQUIRE(StrDict_find(&dict, StrView_from_cstr("app")) == -1);
+    REQUIRE(StrDict_find(&dict, StrView_from_cstr("zebra")) == -1);
+    REQUIRE(StrDict_lower_bound(&dict, StrView_from_cstr("b")) == 3);
+    REQUIRE(StrDict_lower_bound(&dict, StrView_from_cstr("zebra")) == 7);
+  }
+  SECTION("prefix range") {
+    Ssize first;
+    REQUIRE(StrDict_prefix_range(&dict, StrView_from_cstr("appl"), &first) == 3);
+    REQUIRE(first == 0);
+    REQUIRE(StrDict_prefix_range(&dict, StrView_from_cstr("band"), &first) == 2);
+    REQUIRE(first == 4);
+    REQUIRE(StrDict_prefix_range(&dict, StrView_from_cstr("cat"), &first) == 0);
+    REQUIRE(StrDict_prefix_range(&dict, StrView_from_cstr(""), &first) == 7);
+  }
+  SECTION("many blocks") {
+    char names[100][4];
+    StrView many[100];
+    for (int i = 0; i < 100; ++i) {
+      names[i][0] = (char)('a' + i / 10);
+      names[i][1] = (char)('0' + i % 10);
+      many[i] = StrView_from_raw(names[i], 2);
+    }
+    StrDict big;
+    REQUIRE(StrDict_build(&big, many, 100));
+    REQUIRE(StrDict_find(&big, StrView_from_cstr("e7")) == 47);
+    REQUIRE(StrView_is_equal(StrDict_get(&big, 99, out, sizeof(out)), StrView_from_cstr("j9")));
+    Ssize first;
+    REQUIRE(StrDict_prefix_range(&big, StrView_from_cstr("c"), &first) == 10);
+    REQUIRE(first == 20);
+    StrDict_free(&big);
+  }
+  SECTION("invalid bytes") {
+    REQUIRE_FALSE(StrDict_from_bytes(&dict, StrView_from_cstr("not a dictionary, not at all")));
+  }
+
+  StrDict_free(&built);
+}
+
+TEST_CASE("StrLineReader_next", "[StrLineReader]") {
+  int fds[2];
+  REQUIRE(pipe(fds) == 0);
+  StrLineReader reader;
+  StrView line;
+
+  SECTION("lines") {
+    const char input[] = "first\r\n\nthird line is longer than the buffer\nlast";
+    REQUIRE(write(fds[1], input, sizeof(input) - 1) == (Ssize)sizeof(input) - 1);
+    close(fds[1]);
+
+    REQUIRE(StrLineReader_init(&reader, fds[0], 8, STR_LINE_CRLF));
+    REQUIRE(StrLineReader_next(&reader, &line));
+    REQUIRE(StrView_is_equal(line, StrView_from_cstr("first")));
+    REQUIRE(StrLineReader_next(&reader, &line));
+    REQUIRE(StrView_is_equal(line, StrView_from_cstr("")));
+    REQUIRE(StrLineReader_next(&reader, &line));
+    REQUIRE(StrView_is_equal(line, StrView_from_cstr("third line is longer than the buffer")));
+    REQUIRE(StrLineReader_next(&reader, &line));
+    REQUIRE(StrView_is_equal(line, StrView_from_cstr("last")));
+    REQUIRE_FALSE(StrLineReader_next(&reader, &line));
+    REQUIRE(reader.error == 0);
+  }
+  SECTION("invalid utf8") {
+    const char input[] = "caf\xC3\xA9\nbad \xC3\nok\n";
+    REQUIRE(write(fds[1], input, sizeof(input) - 1) == (Ssize)sizeof(input) - 1);
+    close(fds[1]);
+
+    REQUIRE(StrLineReader_init(&reader, fds[0], 0, STR_LINE_UTF8));
+    REQUIRE(StrLineReader_next(&reader, &line));
+    REQUIRE(StrView_is_equal(line, StrView_from_cstr("caf\xC3\xA9")));
+    REQUIRE(reader.error == 0);
+    REQUIRE(StrLineReader_next(&reader, &line));
+    REQUIRE(reader.error == EILSEQ);
+    REQUIRE(StrView_is_equal(line, StrView_from_cstr("bad \xC3")));
+    REQUIRE(StrLineReader_next(&reader, &line));
+    REQUIRE(reader.error == 0);
+    REQUIRE(StrView_is_equal(line, StrView_from_cstr("ok")));
+    REQUIRE_FALSE(StrLineReader_next(&reader, &line));
+    REQUIRE(reader.error == 0);
+  }
+  SECTION("loop goes on after an invalid line") {
+    const char input[] = "a\n\xFF\nb\n\xC3\nc";
+    REQUIRE(write(fds[1], input, sizeof(input) - 1) == (Ssize)sizeof(input) - 1);
+    close(fds[1]);
+
+    REQUIRE(StrLineReader_init(&reader, fds[0], 0, STR_LINE_UTF8));
+    int lines = 0;
+    int invalid = 0;
+    while (StrLineReader_next(&reader, &line)) {
+      lines++;
+      invalid += reader.error == EILSEQ;
+    }
+    REQUIRE(lines == 5);
+    REQUIRE(invalid == 2);
+    REQUIRE(reader.error == 0);
+  }
+
+  StrLineReader_free(&reader);
+  close(fds[0]);
+}
+
+TEST_CASE("StrTrigramIndex", "[StrTrigramIndex]") {
+  const char *texts[] = {"the quick brown fox", "jumps over", "the lazy dog", "brown bread", "ox"};
+  StrView docs[5];
+  for (int i = 0; i < 5; ++i) docs[i] = StrView_from_cstr(texts[i]);
+
+  StrTrigramIndex built;
+  REQUIRE(StrTrigramIndex_build(&built, docs, 5));
+  StrTrigramIndex index;
+  REQUIRE(StrTrigramIndex_from_bytes(&index, StrTrigramIndex_bytes(&built)));
+  REQUIRE(index.doc_count == 5);
+  Ssize ids[5];
+
+  SECTION("search") {
+    REQUIRE(StrTrigramIndex_search(&index, docs, StrView_from_cstr("brown"), ids, 5) == 2);
+    REQUIRE(ids[0] == 0);
+    REQUIRE(ids[1] == 3);
+    REQUIRE(StrTrigramIndex_search(&index, docs, StrView_from_cstr("the "), ids, 5) == 2);
+    REQUIRE(ids[1] == 2);
+    REQUIRE(StrTrigramIndex_search(&index, docs, StrView_from_cstr("cat"), ids, 5) == 0);
+  }
+  SECTION("candidates") {
+    // all trigrams of "brown brown" are in "brown bread"
+    REQUIRE(StrTrigramIndex_candidates(&index, StrView_from_cstr("brown brown"), ids, 5) == 1);
+    REQUIRE(ids[0] == 3);
+    REQUIRE(StrTrigramIndex_search(&index, docs, StrView_from_cstr("brown brown"), ids, 5) == 0);
+    REQUIRE(StrTrigramIndex_candidates(&index, StrView_from_cstr("zzz"), ids, 5) == 0);
+  }
+  SECTION("short needle") {
+    REQUIRE(StrTrigramIndex_candidates(&index, StrView_from_cstr("ox"), ids, 5) == 5);
+    REQUIRE(StrTrigramIndex_search(&index, docs, StrView_from_cstr("ox"), ids, 2) == 2);
+    REQUIRE(ids[0] == 0);
+    REQUIRE(ids[1] == 4);
+  }
+  SECTION("invalid bytes") {
+    REQUIRE_FALSE(StrTrigramIndex_from_bytes(&index, StrView_from_cstr("SVPS not a trigram index at all")));
+  }
+
+  StrTrigramIndex_free(&built);
+}
+
+TEST_CASE("UTF8View_to_case", "[UTF8View]") {
+  uint8_t out[96];
+
+  SECTION("ascii") {
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("Hello, World! 0123456789 and A Longer Tail To Map"));
+    UTF8View lower = UTF8View_to_case(s8, STR_CASE_LOWER, out, sizeof(out));
+    REQUIRE(StrView_is_equal(StrView_cast(lower), StrView_from_cstr("hello, world! 0123456789 and a longer tail to map")));
+    UTF8View upper = UTF8View_to_case(lower, STR_CASE_UPPER, out, sizeof(out));
+    REQUIRE(StrView_is_equal(StrView_cast(upper), StrView_from_cstr("HELLO, WORLD! 0123456789 AND A LONGER TAIL TO MAP")));
+  }
+  SECTION("unchanged") {
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("already lower \xC3\xA9t\xC3\xA9"));
+    UTF8View lower = UTF8View_to_case(s8, STR_CASE_LOWER, out, sizeof(out));
+    REQUIRE(lower.data == s8.data);
+    REQUIRE(lower.size == s8.size);
+  }
+  SECTION("unicode") {
+    // "Straße ÉTÉ Σ"
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("Stra\xC3\x9F" "e \xC3\x89T\xC3\x89 \xCE\xA3"));
+    REQUIRE(StrView_is_equal(StrView_cast(UTF8View_to_case(s8, STR_CASE_LOWER, out, sizeof(out))),
+                             StrView_from_cstr("stra\xC3\x9F" "e \xC3\xA9t\xC3\xA9 \xCF\x83")));
+    REQUIRE(UTF8View_case_size(s8, STR_CASE_UPPER) == 16);
+    REQUIRE(StrView_is_equal(StrView_cast(UTF8View_to_case(s8, STR_CASE_UPPER, out, sizeof(out))),
+                             StrView_from_cstr("STRASSE \xC3\x89T\xC3\x89 \xCE\xA3")));
+  }
+  SECTION("size changes") {
+    // U+023A (2 bytes) lowers to U+2C65 (3 bytes)
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("A\xC8\xBA"));
+    REQUIRE(UTF8View_case_size(s8, STR_CASE_LOWER) == 4);
+    UTF8View too_small = UTF8View_to_case(s8, STR_CASE_LOWER, out, 3);
+    REQUIRE(too_small.data == NULL);
+    REQUIRE(too_small.size == -4);
+  }
+}
+
+TEST_CASE("UTF8View_to_case_inplace", "[UTF8View]") {
+  uint8_t text[] = "Mixed CASE \xC3\x89t\xC3\xA9 \xC8\xBA end";
+
+  REQUIRE(UTF8View_to_case_inplace(text, 16, STR_CASE_UPPER) == 16);
+  REQUIRE(StrView_is_equal(StrView_from_raw(text, 16), StrView_from_cstr("MIXED CASE \xC3\x89T\xC3\x89")));
+  // stops before U+023A that changes size
+  REQUIRE(UTF8View_to_case_inplace(text, sizeof(text) - 1, STR_CASE_LOWER) == 17);
+  REQUIRE(StrView_is_equal(StrView_from_raw(text, 17), StrView_from_cstr("mixed case \xC3\xA9t\xC3\xA9 ")));
+}
+
+TEST_CASE("StrView_hash", "[StrView]") {
+  StrView a = StrView_from_cstr("a fairly long key to hash");
+  char copy[] = "a fairly long key to hash";
+
+  REQUIRE(StrView_hash(a, 1) == StrView_hash(StrView_from_cstr(copy), 1));
+  REQUIRE(StrView_hash(a, 1) != StrView_hash(a, 2));
+  REQUIRE(StrView_hash(StrView_from_cstr("ab"), 0) != StrView_hash(StrView_from_raw("ab\0", 3), 0));
+}
+
+TEST_CASE("StrView_batch", "[StrView]") {
+  StrView views[] = {
+    StrView_from_cstr("apple"), StrView_from_cstr("caf\xC3\xA9"), StrView_from_cstr("bad \xC3"),
+    StrView_from_cstr(""), StrView_from_cstr("apple"),
+  };
+  uint64_t bitmap[1];
+
+  SECTION("validate and count") {
+    REQUIRE(StrView_batch_is_valid_utf8(views, 5, bitmap) == 4);
+    REQUIRE(bitmap[0] == 0x1B);
+    Ssize counts[2];
+    StrView_batch_count_codepoint(views, 2, counts);
+    REQUIRE(counts[0] == 5);
+    REQUIRE(counts[1] == 4);
+  }
+  SECTION("compare to a value") {
+    REQUIRE(StrView_batch_is_equal(views, 5, StrView_from_cstr("apple"), bitmap) == 2);
+    REQUIRE(bitmap[0] == 0x11);
+    int8_t orders[5];
+    StrView_batch_compare(views, 5, StrView_from_cstr("b"), orders);
+    REQUIRE(orders[0] == -1);
+    REQUIRE(orders[1] == 1);
+    REQUIRE(orders[2] == 1);
+    REQUIRE(orders[3] == -1);
+  }
+  SECTION("hash") {
+    uint64_t hashes[5];
+    StrView_batch_hash(views, 5, 42, hashes);
+    REQUIRE(hashes[0] == hashes[4]);
+    REQUIRE(hashes[1] == StrView_hash(views[1], 42));
+  }
+}
+
+TEST_CASE("StrColumn", "[StrColumn]") {
+  const char bytes[] = "applecaf\xC3\xA9" "bad \xC3" "apple";
+  const int32_t offsets[] = {0, 5, 10, 15, 15, 20};
+  StrColumn column = {(const uint8_t*)bytes, offsets, 5};
+  uint64_t bitmap[1];
+
+  REQUIRE(StrView_is_equal(StrColumn_get(column, 1), StrView_from_cstr("caf\xC3\xA9")));
+
+  SECTION("validate and count") {
+    REQUIRE(StrColumn_is_valid_utf8(column, bitmap) == 4);
+    REQUIRE(bitmap[0] == 0x1B);
+    Ssize counts[5];
+    StrColumn_count_codepoint(column, counts);
+    REQUIRE(counts[0] == 5);
+    REQUIRE(counts[1] == 4);
+    REQUIRE(counts[3] == 0);
+  }
+  SECTION("compare to a value") {
+    REQUIRE(StrColumn_is_equal(column, StrView_from_cstr("apple"), bitmap) == 2);
+    REQUIRE(bitmap[0] == 0x11);
+    int8_t orders[5];
+    StrColumn_compare(column, StrView_from_cstr("bad \xC3"), orders);
+    REQUIRE(orders[0] == -1);
+    REQUIRE(orders[2] == 0);
+    REQUIRE(orders[3] == -1);
+  }
+  SECTION("hash") {
+    uint64_t hashes[5];
+    StrColumn_hash(column, 42, hashes);
+    REQUIRE(hashes[0] == hashes[4]);
+    REQUIRE(hashes[1] == StrView_hash(StrView_from_cstr("caf\xC3\xA9"), 42));
+  }
+}
+
+TEST_CASE("UTF8View_get_grapheme", "[UTF8View]") {
+  SECTION("combining marks and crlf") {
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("e\xCC\x81x\r\ny"));
+    UTF8View g = UTF8View_get_grapheme(s8);
+    REQUIRE(g.size == 3);
+    REQUIRE(UTF8View_count_grapheme(s8) == 4);
+  }
+  SECTION("emoji sequences") {
+    // family U+1F468 ZWJ U+1F469 ZWJ U+1F467, flags U+1F1FA U+1F1F8 U+1F1EB U+1F1F7
+    UTF8View family = UTF8View_from_strview(StrView_from_cstr(
+      "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7"));
+    REQUIRE(UTF8View_get_grapheme(family).size == family.size);
+    UTF8View flags = UTF8View_from_strview(StrView_from_cstr(
+      "\xF0\x9F\x87\xBA\xF0\x9F\x87\xB8\xF0\x9F\x87\xAB\xF0\x9F\x87\xB7"));
+    REQUIRE(UTF8View_get_grapheme(flags).size == 8);
+    REQUIRE(UTF8View_count_grapheme(flags) == 2);
+  }
+  SECTION("hangul") {
+    // U+1100 U+1161 U+11A8 then U+AC00
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8\xEA\xB0\x80"));
+    REQUIRE(UTF8View_get_grapheme(s8).size == 9);
+    REQUIRE(UTF8View_count_grapheme(s8) == 2);
+  }
+  SECTION("empty") {
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr(""));
+    REQUIRE(UTF8View_get_grapheme(s8).size == 0);
+    REQUIRE(UTF8View_count_grapheme(s8) == 0);
+  }
+}
+
+TEST_CASE("UTF8View_width", "[UTF8View]") {
+  SECTION("ascii") {
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("a plain ascii cell that is longer than a block\t"));
+    REQUIRE(UTF8View_width(s8) == 46);
+    REQUIRE(UTF8View_count_grapheme(s8) == 47);
+  }
+  SECTION("wide and zero width") {
+    // U+4E2D U+6587, e U+0301, U+2764 U+FE0F
+    REQUIRE(UTF8View_width(UTF8View_from_strview(StrView_from_cstr("\xE4\xB8\xAD\xE6\x96\x87"))) == 4);
+    REQUIRE(UTF8View_width(UTF8View_from_strview(StrView_from_cstr("e\xCC\x81"))) == 1);
+    REQUIRE(UTF8View_width(UTF8View_from_strview(StrView_from_cstr("\xE2\x9D\xA4"))) == 1);
+    REQUIRE(UTF8View_width(UTF8View_from_strview(StrView_from_cstr("\xE2\x9D\xA4\xEF\xB8\x8F"))) == 2);
+  }
+  SECTION("truncate") {
+    UTF8View s8 = UTF8View_from_strview(StrView_from_cstr("ab\xE4\xB8\xAD" "e\xCC\x81"));
+    REQUIRE(UTF8View_truncate_width(s8, 3).size == 2);
+    REQUIRE(UTF8View_truncate_width(s8, 4).size == 5);
+    REQUIRE(UTF8View_truncate_width(s8, 5).size == s8.size);
+    REQUIRE(UTF8View_truncate_width(s8, 0).size == 0);
+  }
+}